@@ -1,76 +1,77 @@
-/********************************************************************************
- * @brief Implementation details for the ATmega328P ADC driver.
- ********************************************************************************/
-#include "adc.h"
-#include "type_traits.h"
-
-namespace driver 
-{
-namespace adc 
-{
-namespace 
-{
-
-constexpr uint16_t MinVal{0};
-constexpr uint16_t MaxVal{1023};
-constexpr uint8_t AdcPortOffset{14};
-
-// -----------------------------------------------------------------------------
-constexpr bool isPinNumberValid(const uint8_t pin) 
-{
-	return (pin >= Pin::A0 && pin <= Pin::A5) || 
-        (pin >= Port::C0 && pin <= Port::C5);
-}
-
-// -----------------------------------------------------------------------------
-constexpr uint8_t isPinAdjustedForOffset(const uint8_t pin) 
-{
-    return pin <= Pin::A5 ? pin : pin - AdcPortOffset;
-}
-} // namespace 
-
-// -----------------------------------------------------------------------------
-void init(void) { read(Pin::A0); }
-
-// -----------------------------------------------------------------------------
-double getDutyCycle(const uint8_t pin) 
-{ 
-	return read(pin) / static_cast<double>(MaxVal); 
-}
-
-// -----------------------------------------------------------------------------
-uint16_t read(const uint8_t pin) 
-{
-   if (!isPinNumberValid(pin)) { return 0; }
-   ADMUX = (1 << REFS0) | isPinAdjustedForOffset(pin);
-   utils::set(ADCSRA, ADEN, ADSC, ADPS0, ADPS1, ADPS2);
-   while (!utils::read(ADCSRA, ADIF));
-   utils::set(ADCSRA, ADIF);
-   return ADC;
-}
-
-// -----------------------------------------------------------------------------
-bool getDutyCycleParameters_ms(const uint8_t pin, 
-                               const uint8_t pwmPeriodMs, 
-                               uint8_t& pwmOnTimeMs, 
-                               uint8_t& pwmOffTimeMs) 
-{
-    if (!isPinNumberValid(pin)) { return false; }
-	pwmOnTimeMs = utils::round<uint8_t>(pwmPeriodMs * getDutyCycle(pin));
-	pwmOffTimeMs = pwmPeriodMs - pwmOnTimeMs;
-	return true;
-}
-
-// -----------------------------------------------------------------------------
-bool getDutyCycleParameters_us(const uint8_t pin, 
-                               const uint16_t pwmPeriodUs, 
-                               uint16_t& pwmOnTimeUs,
-                               uint16_t& pwmOffTimeUs) {
-    if (!isPinNumberValid(pin)) { return false; }
-	pwmOnTimeUs = utils::round<uint16_t>(pwmPeriodUs * getDutyCycle(pin));
-	pwmOffTimeUs = pwmPeriodUs - pwmOnTimeUs;
-	return true;
-}
-
-} // namespace adc
-} // namespace driver
+/********************************************************************************
+ * @brief Implementation details for the ATmega328P ADC driver.
+ ********************************************************************************/
+#include "adc.h"
+#include "type_traits.h"
+
+namespace driver 
+{
+namespace adc 
+{
+namespace 
+{
+
+constexpr uint16_t MinVal{0};
+constexpr uint16_t MaxVal{1023};
+constexpr uint8_t AdcPortOffset{14};
+
+// Samples are scaled to duty cycles by multiplying with 2^(FractionalBits + 16) 
+// / MaxVal and shifting 16 bits, which avoids dividing at runtime.
+constexpr uint8_t DutyCycleShift{16};
+constexpr uint32_t DutyCycleFactor{((1UL << (DutyCycle::FractionalBits + DutyCycleShift)) + 
+                                     MaxVal / 2U) / MaxVal};
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t isPinAdjustedForOffset(const uint8_t pin) 
+{
+    return pin <= Pin::A5 ? pin : pin - AdcPortOffset;
+}
+} // namespace 
+
+// -----------------------------------------------------------------------------
+void init(void) { read(Pin::A0); }
+
+// -----------------------------------------------------------------------------
+DutyCycle getDutyCycle(const uint8_t pin) 
+{ 
+    const uint32_t scaled{read(pin) * DutyCycleFactor};
+    return DutyCycle::fromRaw(static_cast<DutyCycle::Raw>(
+        (scaled + (1UL << (DutyCycleShift - 1U))) >> DutyCycleShift));
+}
+
+// -----------------------------------------------------------------------------
+uint16_t read(const uint8_t pin) 
+{
+   if (!detail::isPinNumberValid(pin)) { return 0; }
+   ADMUX = (1 << REFS0) | isPinAdjustedForOffset(pin);
+   utils::set(ADCSRA, ADEN, ADSC, ADPS0, ADPS1, ADPS2);
+   while (!utils::read(ADCSRA, ADIF));
+   utils::set(ADCSRA, ADIF);
+   return ADC;
+}
+
+// -----------------------------------------------------------------------------
+bool getDutyCycleParameters_ms(const uint8_t pin, 
+                               const uint8_t pwmPeriodMs, 
+                               uint8_t& pwmOnTimeMs, 
+                               uint8_t& pwmOffTimeMs) 
+{
+    if (!detail::isPinNumberValid(pin)) { return false; }
+	pwmOnTimeMs = getDutyCycle(pin).scale<uint8_t>(pwmPeriodMs);
+	pwmOffTimeMs = pwmPeriodMs - pwmOnTimeMs;
+	return true;
+}
+
+// -----------------------------------------------------------------------------
+bool getDutyCycleParameters_us(const uint8_t pin, 
+                               const uint16_t pwmPeriodUs, 
+                               uint16_t& pwmOnTimeUs,
+                               uint16_t& pwmOffTimeUs) {
+    if (!detail::isPinNumberValid(pin)) { return false; }
+	pwmOnTimeUs = getDutyCycle(pin).scale<uint16_t>(pwmPeriodUs);
+	pwmOffTimeUs = pwmPeriodUs - pwmOnTimeUs;
+	return true;
+}
+
+} // namespace adc
+} // namespace driver
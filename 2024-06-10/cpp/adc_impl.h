@@ -0,0 +1,37 @@
+/********************************************************************************
+ * @brief Implementation details of the ATmega328P ADC driver.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+#include "adc.h"
+
+namespace driver 
+{
+namespace adc 
+{
+namespace detail
+{
+
+// -----------------------------------------------------------------------------
+constexpr bool isPinNumberValid(const uint8_t pin) 
+{
+	return (pin >= Pin::A0 && pin <= Pin::A5) || 
+        (pin >= Port::C0 && pin <= Port::C5);
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <size_t Size, typename Sum>
+uint16_t read(const uint8_t pin, container::SlidingWindow<uint16_t, Size, Sum>& window)
+{
+    if (!detail::isPinNumberValid(pin)) { return 0; }
+    const auto sample{read(pin)};
+    window.push(sample);
+    return sample;
+}
+
+} // namespace adc
+} // namespace driver
@@ -0,0 +1,197 @@
+/********************************************************************************
+ * @brief Algorithms for sorting, searching and copying container content.
+ *
+ * @note Sorting and searching algorithms require contiguous storage and are
+ *       performed on pointer ranges, which are provided by Array, Vector and
+ *       StaticVector via data() and size(). Overloads taking the container
+ *       directly are provided for convenience. Linear algorithms, such as
+ *       fill, copy and finding the minimum or maximum, accept any iterators,
+ *       including List iterators.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+
+namespace container
+{
+
+/********************************************************************************
+ * @brief Default comparison used by the algorithms, where a < b.
+ ********************************************************************************/
+struct Less
+{
+    template <typename T>
+    constexpr bool operator()(const T& a, const T& b) const { return a < b; }
+};
+
+/********************************************************************************
+ * @brief Returns the smallest of two values.
+ *
+ * @param a The first value.
+ * @param b The second value.
+ *
+ * @return A reference to the smallest value (a if they are equal).
+ ********************************************************************************/
+template <typename T>
+constexpr const T& min(const T& a, const T& b);
+
+/********************************************************************************
+ * @brief Returns the largest of two values.
+ *
+ * @param a The first value.
+ * @param b The second value.
+ *
+ * @return A reference to the largest value (a if they are equal).
+ ********************************************************************************/
+template <typename T>
+constexpr const T& max(const T& a, const T& b);
+
+/********************************************************************************
+ * @brief Sorts specified range via introsort. Small partitions are sorted via
+ *        insertion sort and heapsort is used if the recursion gets too deep,
+ *        which guarantees O(n log n) in the worst case. The sort isn't stable.
+ *
+ * @tparam Compare Type of the comparison function object.
+ *
+ * @param first   Pointer to the first element of the range.
+ * @param last    Pointer to the end of the range (one past the last element).
+ * @param compare Comparison returning true if its first argument is to be
+ *                placed before its second argument (default = ascending).
+ ********************************************************************************/
+template <typename T, typename Compare = Less>
+void sort(T* first, T* last, Compare compare = Compare{});
+
+/********************************************************************************
+ * @brief Sorts referenced container in ascending order via introsort.
+ *
+ * @param container Reference to the container to sort.
+ ********************************************************************************/
+template <typename Container>
+void sort(Container& container);
+
+/********************************************************************************
+ * @brief Partially sorts specified range so that the element at nth is the
+ *        element that would be placed there if the range was sorted. No
+ *        element before nth is greater and no element after nth is smaller.
+ *        The average complexity is O(n).
+ *
+ * @tparam Compare Type of the comparison function object.
+ *
+ * @param first   Pointer to the first element of the range.
+ * @param nth     Pointer to the element to place in sorted position.
+ * @param last    Pointer to the end of the range (one past the last element).
+ * @param compare Comparison returning true if its first argument is to be
+ *                placed before its second argument (default = ascending).
+ ********************************************************************************/
+template <typename T, typename Compare = Less>
+void nthElement(T* first, T* nth, T* last, Compare compare = Compare{});
+
+/********************************************************************************
+ * @brief Finds the first element in specified sorted range that isn't less
+ *        than specified value via binary search.
+ *
+ * @param first   Pointer to the first element of the range.
+ * @param last    Pointer to the end of the range (one past the last element).
+ * @param value   Reference to the value to search for.
+ * @param compare Comparison the range is sorted by (default = ascending).
+ *
+ * @return Pointer to the first element not less than the value, or last if no
+ *         such element exists.
+ ********************************************************************************/
+template <typename T, typename Compare = Less>
+T* lowerBound(T* first, T* last, const T& value, Compare compare = Compare{});
+
+/********************************************************************************
+ * @brief Finds the first element in specified sorted range that's greater
+ *        than specified value via binary search.
+ *
+ * @param first   Pointer to the first element of the range.
+ * @param last    Pointer to the end of the range (one past the last element).
+ * @param value   Reference to the value to search for.
+ * @param compare Comparison the range is sorted by (default = ascending).
+ *
+ * @return Pointer to the first element greater than the value, or last if no
+ *         such element exists.
+ ********************************************************************************/
+template <typename T, typename Compare = Less>
+T* upperBound(T* first, T* last, const T& value, Compare compare = Compare{});
+
+/********************************************************************************
+ * @brief Indicates if specified value is present in specified sorted range
+ *        via binary search.
+ *
+ * @param first   Pointer to the first element of the range.
+ * @param last    Pointer to the end of the range (one past the last element).
+ * @param value   Reference to the value to search for.
+ * @param compare Comparison the range is sorted by (default = ascending).
+ *
+ * @return True if the value is present, else false.
+ ********************************************************************************/
+template <typename T, typename Compare = Less>
+bool binarySearch(const T* first, const T* last, const T& value,
+                  Compare compare = Compare{});
+
+/********************************************************************************
+ * @brief Finds the smallest element in specified range.
+ *
+ * @tparam Iterator The iterator type.
+ *
+ * @param first   Iterator pointing at the first element of the range.
+ * @param last    Iterator pointing at the end of the range.
+ * @param compare Comparison used to order the elements (default = ascending).
+ *
+ * @return Iterator pointing at the first smallest element, or last if the range
+ *         is empty.
+ ********************************************************************************/
+template <typename Iterator, typename Compare = Less>
+Iterator minElement(Iterator first, Iterator last, Compare compare = Compare{});
+
+/********************************************************************************
+ * @brief Finds the largest element in specified range.
+ *
+ * @tparam Iterator The iterator type.
+ *
+ * @param first   Iterator pointing at the first element of the range.
+ * @param last    Iterator pointing at the end of the range.
+ * @param compare Comparison used to order the elements (default = ascending).
+ *
+ * @return Iterator pointing at the first largest element, or last if the range
+ *         is empty.
+ ********************************************************************************/
+template <typename Iterator, typename Compare = Less>
+Iterator maxElement(Iterator first, Iterator last, Compare compare = Compare{});
+
+/********************************************************************************
+ * @brief Assigns specified value to each element of specified range. Ranges
+ *        of single-byte trivially copyable elements are filled via memset.
+ *
+ * @tparam Iterator The iterator type.
+ *
+ * @param first Iterator pointing at the first element of the range.
+ * @param last  Iterator pointing at the end of the range.
+ * @param value Reference to the value to assign.
+ ********************************************************************************/
+template <typename Iterator, typename T>
+void fill(Iterator first, Iterator last, const T& value);
+
+/********************************************************************************
+ * @brief Copies the elements of specified range to specified destination.
+ *        Ranges of trivially copyable elements are copied via memmove.
+ *
+ * @tparam InputIterator  The iterator type of the source range.
+ * @tparam OutputIterator The iterator type of the destination.
+ *
+ * @param first       Iterator pointing at the first element of the range.
+ * @param last        Iterator pointing at the end of the range.
+ * @param destination Iterator pointing at the start of the destination.
+ *
+ * @return Iterator pointing at the end of the copied elements in the
+ *         destination.
+ ********************************************************************************/
+template <typename InputIterator, typename OutputIterator>
+OutputIterator copy(InputIterator first, InputIterator last,
+                    OutputIterator destination);
+
+} // namespace container
+
+#include "algorithm_impl.h"
\ No newline at end of file
@@ -0,0 +1,334 @@
+/********************************************************************************
+ * @brief Implementation details for the container algorithms.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+#include <string.h>
+
+#include "type_traits.h"
+#include "utils.h"
+
+namespace container
+{
+namespace detail
+{
+
+/********************************************************************************
+ * @brief Partitions with this many elements or fewer are sorted via insertion
+ *        sort, which is faster than partitioning for small ranges.
+ ********************************************************************************/
+constexpr ptrdiff_t InsertionSortLimit{16};
+
+// -----------------------------------------------------------------------------
+inline size_t depthLimit(size_t size)
+{
+    size_t depth{};
+    while (size > 1)
+    {
+        size >>= 1;
+        depth += 2;
+    }
+    return depth;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void insertionSort(T* first, T* last, Compare& compare)
+{
+    if (first == last) { return; }
+    for (T* i{first + 1}; i < last; ++i)
+    {
+        T value{utils::move(*i)};
+        T* j{i};
+        for (; j > first && compare(value, *(j - 1)); --j)
+        {
+            *j = utils::move(*(j - 1));
+        }
+        *j = utils::move(value);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void siftDown(T* first, size_t root, const size_t size, Compare& compare)
+{
+    T value{utils::move(first[root])};
+    for (size_t child{2 * root + 1}; child < size; child = 2 * root + 1)
+    {
+        if (child + 1 < size && compare(first[child], first[child + 1])) { child++; }
+        if (!compare(value, first[child])) { break; }
+        first[root] = utils::move(first[child]);
+        root = child;
+    }
+    first[root] = utils::move(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void heapSort(T* first, T* last, Compare& compare)
+{
+    const size_t size{static_cast<size_t>(last - first)};
+    for (size_t i{size / 2}; i-- > 0;) { siftDown(first, i, size, compare); }
+    for (size_t end{size}; end-- > 1;)
+    {
+        utils::swap(first[0], first[end]);
+        siftDown(first, 0, end, compare);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+T* partition(T* first, T* last, Compare& compare)
+{
+    T* middle{first + (last - first) / 2};
+    T* back{last - 1};
+
+    // Order the first, middle and last element, then use the median as pivot.
+    // The last element is now guaranteed to stop the left scan below.
+    if (compare(*middle, *first)) { utils::swap(*middle, *first); }
+    if (compare(*back, *middle))
+    {
+        utils::swap(*back, *middle);
+        if (compare(*middle, *first)) { utils::swap(*middle, *first); }
+    }
+    utils::swap(*first, *middle);
+
+    T* left{first};
+    T* right{last};
+    while (true)
+    {
+        do { ++left; } while (compare(*left, *first));
+        do { --right; } while (compare(*first, *right));
+        if (left >= right) { break; }
+        utils::swap(*left, *right);
+    }
+    utils::swap(*first, *right);
+    return right;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void introsort(T* first, T* last, size_t depth, Compare& compare)
+{
+    while (last - first > InsertionSortLimit)
+    {
+        if (depth == 0)
+        {
+            heapSort(first, last, compare);
+            return;
+        }
+        depth--;
+        T* pivot{partition(first, last, compare)};
+
+        // Recurse into the smaller partition only to keep the stack depth
+        // logarithmic, then continue with the larger partition.
+        if (pivot - first < last - pivot)
+        {
+            introsort(first, pivot, depth, compare);
+            first = pivot + 1;
+        }
+        else
+        {
+            introsort(pivot + 1, last, depth, compare);
+            last = pivot;
+        }
+    }
+    insertionSort(first, last, compare);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename T>
+void fill(Iterator first, Iterator last, const T& value)
+{
+    for (; first != last; ++first) { *first = value; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename U>
+void fill(T* first, T* last, const U& value)
+{
+    if (first >= last) { return; }
+    if constexpr (sizeof(T) == 1 && type_traits::is_trivially_copyable<T>::value)
+    {
+        const T byte = static_cast<T>(value);
+        memset(first, *reinterpret_cast<const unsigned char*>(&byte), last - first);
+    }
+    else
+    {
+        for (; first < last; ++first) { *first = value; }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename InputIterator, typename OutputIterator>
+OutputIterator copy(InputIterator first, InputIterator last, OutputIterator destination)
+{
+    for (; first != last; ++first)
+    {
+        *destination = *first;
+        ++destination;
+    }
+    return destination;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* copyRange(const T* first, const T* last, T* destination)
+{
+    if (first >= last) { return destination; }
+    utils::copyElements(destination, first, static_cast<size_t>(last - first));
+    return destination + (last - first);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* copy(T* first, T* last, T* destination)
+{
+    return copyRange<T>(first, last, destination);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* copy(const T* first, const T* last, T* destination)
+{
+    return copyRange<T>(first, last, destination);
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr const T& min(const T& a, const T& b) { return b < a ? b : a; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr const T& max(const T& a, const T& b) { return a < b ? b : a; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void sort(T* first, T* last, Compare compare)
+{
+    if (last - first < 2) { return; }
+    detail::introsort(first, last, detail::depthLimit(last - first), compare);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Container>
+void sort(Container& container)
+{
+    sort(container.data(), container.data() + container.size());
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void nthElement(T* first, T* nth, T* last, Compare compare)
+{
+    if (nth >= last) { return; }
+    size_t depth{detail::depthLimit(last - first)};
+
+    while (last - first > detail::InsertionSortLimit)
+    {
+        if (depth == 0)
+        {
+            detail::heapSort(first, last, compare);
+            return;
+        }
+        depth--;
+        T* pivot{detail::partition(first, last, compare)};
+        if (pivot == nth) { return; }
+        if (nth < pivot) { last = pivot; }
+        else { first = pivot + 1; }
+    }
+    detail::insertionSort(first, last, compare);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+T* lowerBound(T* first, T* last, const T& value, Compare compare)
+{
+    size_t count{static_cast<size_t>(last - first)};
+    while (count > 0)
+    {
+        const size_t step{count / 2};
+        T* middle{first + step};
+        if (compare(*middle, value))
+        {
+            first = middle + 1;
+            count -= step + 1;
+        }
+        else { count = step; }
+    }
+    return first;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+T* upperBound(T* first, T* last, const T& value, Compare compare)
+{
+    size_t count{static_cast<size_t>(last - first)};
+    while (count > 0)
+    {
+        const size_t step{count / 2};
+        T* middle{first + step};
+        if (!compare(value, *middle))
+        {
+            first = middle + 1;
+            count -= step + 1;
+        }
+        else { count = step; }
+    }
+    return first;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+bool binarySearch(const T* first, const T* last, const T& value, Compare compare)
+{
+    const T* element{lowerBound<const T>(first, last, value, compare)};
+    return element != last && !compare(value, *element);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename Compare>
+Iterator minElement(Iterator first, Iterator last, Compare compare)
+{
+    if (first == last) { return last; }
+    Iterator result{first};
+    for (++first; first != last; ++first)
+    {
+        if (compare(*first, *result)) { result = first; }
+    }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename Compare>
+Iterator maxElement(Iterator first, Iterator last, Compare compare)
+{
+    if (first == last) { return last; }
+    Iterator result{first};
+    for (++first; first != last; ++first)
+    {
+        if (compare(*result, *first)) { result = first; }
+    }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename T>
+void fill(Iterator first, Iterator last, const T& value)
+{
+    detail::fill(first, last, value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename InputIterator, typename OutputIterator>
+OutputIterator copy(InputIterator first, InputIterator last,
+                    OutputIterator destination)
+{
+    return detail::copy(first, last, destination);
+}
+
+} // namespace container
\ No newline at end of file
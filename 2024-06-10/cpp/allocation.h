@@ -0,0 +1,239 @@
+/********************************************************************************
+ * @brief Allocation policies for containers.
+ *
+ * @note An allocation policy provides a nested class template Allocator<Block>,
+ *       which is used by the container to allocate blocks of the specified type.
+ *       Each allocator provides the following member functions:
+ *
+ *           - Block* allocate()             Allocates a single block.
+ *           - void deallocate(Block* block) Deallocates specified block.
+ *
+ *       Policies that can also be used for vectors provide the following
+ *       member function for resizing arrays of blocks:
+ *
+ *           - Block* reallocate(Block* block, size_t oldSize, size_t newSize)
+ *                                           Resizes specified array, where
+ *                                           the sizes are given in blocks.
+ *
+ *       Policies allocating heap memory also take the location of the call
+ *       as last argument of allocate and reallocate, which defaults to the
+ *       location of the caller. The heap allocations are thereby recorded
+ *       in the memory statistics at the line of the container calling its
+ *       allocator rather than in this file, see memory_stats.h.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+#include "utils.h"
+
+namespace container
+{
+namespace allocation
+{
+
+/********************************************************************************
+ * @brief Allocation policy where each block is allocated separately on the heap.
+ ********************************************************************************/
+struct Heap
+{
+    /********************************************************************************
+     * @brief Class for allocation of blocks on the heap.
+     *
+     * @tparam Block The type of the allocated blocks.
+     ********************************************************************************/
+    template <typename Block>
+    class Allocator
+    {
+    public:
+        /********************************************************************************
+         * @brief Creates new heap allocator.
+         ********************************************************************************/
+        constexpr Allocator() = default;
+
+        /********************************************************************************
+         * @brief Allocates a new block on the heap.
+         *
+         * @param location The call site of the allocation
+         *                 (default = the location of the caller).
+         *
+         * @return A pointer to the allocated block at success, else a null pointer.
+         ********************************************************************************/
+        Block* allocate(
+            const utils::SourceLocation& location = utils::SourceLocation::current());
+
+        /********************************************************************************
+         * @brief Resizes specified array of blocks on the heap.
+         *
+         * @param block    Pointer to the array to resize (may be null).
+         * @param oldSize  The current size of the array in number of blocks.
+         * @param newSize  The new size of the array in number of blocks.
+         * @param location The call site of the reallocation
+         *                 (default = the location of the caller).
+         *
+         * @return A pointer to the resized array at success, else a null pointer.
+         ********************************************************************************/
+        Block* reallocate(
+            Block* block, const size_t oldSize, const size_t newSize,
+            const utils::SourceLocation& location = utils::SourceLocation::current());
+
+        /********************************************************************************
+         * @brief Deallocates referenced block.
+         *
+         * @param block Pointer to the block to deallocate.
+         ********************************************************************************/
+        void deallocate(Block* block);
+    };
+};
+
+/********************************************************************************
+ * @brief Allocation policy where blocks are allocated from referenced arena,
+ *        see arena.h. Allocation is a pointer bump and deallocation does
+ *        nothing, the memory is instead reclaimed in bulk by releasing or
+ *        resetting the arena.
+ *
+ * @tparam Source Reference to the arena to allocate from. The arena must have
+ *                static storage duration, for instance a global variable.
+ ********************************************************************************/
+template <auto& Source>
+struct Monotonic
+{
+    /********************************************************************************
+     * @brief Class for allocation of blocks from an arena.
+     *
+     * @tparam Block The type of the allocated blocks.
+     ********************************************************************************/
+    template <typename Block>
+    class Allocator
+    {
+    public:
+        /********************************************************************************
+         * @brief Creates new arena allocator.
+         ********************************************************************************/
+        constexpr Allocator() = default;
+
+        /********************************************************************************
+         * @brief Allocates a new block from the arena.
+         *
+         * @return A pointer to the allocated block at success, else a null pointer
+         *         if the arena is exhausted.
+         ********************************************************************************/
+        Block* allocate();
+
+        /********************************************************************************
+         * @brief Resizes specified array of blocks. The most recently allocated
+         *        array is resized in place.
+         *
+         * @param block   Pointer to the array to resize (may be null).
+         * @param oldSize The current size of the array in number of blocks.
+         * @param newSize The new size of the array in number of blocks.
+         *
+         * @return A pointer to the resized array at success, else a null pointer.
+         ********************************************************************************/
+        Block* reallocate(Block* block, const size_t oldSize, const size_t newSize);
+
+        /********************************************************************************
+         * @brief Does nothing, the memory is reclaimed when the arena is released.
+         *
+         * @param block Pointer to the block to deallocate.
+         ********************************************************************************/
+        void deallocate(Block* block);
+    };
+};
+
+/********************************************************************************
+ * @brief Allocation policy where blocks are taken from a fixed-size pool
+ *        reserved at compile time. Allocation and deallocation are performed
+ *        in constant time via a free list and cause no heap fragmentation.
+ *
+ * @tparam NumBlocks The number of blocks in the pool.
+ * @tparam Growable  Indicates if the pool is to be extended with slabs of
+ *                   NumBlocks blocks allocated on the heap when the pool is
+ *                   exhausted (default = false, i.e. the pool has fixed size).
+ *                   Slabs are kept until the allocator is deleted.
+ *
+ * @note The number of blocks must exceed 0, else a compilation error will
+ *       be generated.
+ ********************************************************************************/
+template <size_t NumBlocks, bool Growable = false>
+struct Pool
+{
+    static_assert(NumBlocks > 0, "Pool size cannot be set to 0!");
+
+    /********************************************************************************
+     * @brief Class for allocation of blocks from a pool.
+     *
+     * @tparam Block The type of the allocated blocks.
+     ********************************************************************************/
+    template <typename Block>
+    class Allocator
+    {
+    public:
+        /********************************************************************************
+         * @brief Creates new pool allocator. The pool is fully available and
+         *        no heap memory is allocated.
+         ********************************************************************************/
+        constexpr Allocator() = default;
+
+        /********************************************************************************
+         * @brief Deletes the allocator and the slabs it has allocated.
+         ********************************************************************************/
+        ~Allocator();
+
+        /********************************************************************************
+         * @brief Copy constructor deleted.
+         ********************************************************************************/
+        Allocator(Allocator&) = delete;
+
+        /********************************************************************************
+         * @brief Assignment operator deleted.
+         ********************************************************************************/
+        Allocator& operator=(Allocator&) = delete;
+
+        /********************************************************************************
+         * @brief Allocates a new block from the pool.
+         *
+         * @param location The call site recorded if a slab has to be allocated
+         *                 (default = the location of the caller).
+         *
+         * @return A pointer to the allocated block at success, else a null pointer
+         *         if the pool is exhausted (and couldn't be extended).
+         ********************************************************************************/
+        Block* allocate(
+            const utils::SourceLocation& location = utils::SourceLocation::current());
+
+        /********************************************************************************
+         * @brief Returns referenced block to the pool.
+         *
+         * @param block Pointer to the block to return.
+         ********************************************************************************/
+        void deallocate(Block* block);
+
+    private:
+        union Slot
+        {
+            Slot* next;
+            alignas(Block) uint8_t storage[sizeof(Block)];
+        };
+
+        struct Slab
+        {
+            Slab* next;
+            Slot slots[NumBlocks];
+        };
+
+        bool grow(const utils::SourceLocation& location);
+
+        Slot mySlots[NumBlocks]{};
+        Slot* myFreeList{nullptr};
+        Slab* mySlabs{nullptr};
+        size_t myNumUnused{NumBlocks};
+    };
+};
+
+} // namespace allocation
+} // namespace container
+
+#include "allocation_impl.h"
\ No newline at end of file
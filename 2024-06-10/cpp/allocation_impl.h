@@ -0,0 +1,119 @@
+/********************************************************************************
+ * @brief Implementation details for container allocation policies.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+#include "utils.h"
+
+namespace container
+{
+namespace allocation
+{
+
+// -----------------------------------------------------------------------------
+template <typename Block>
+Block* Heap::Allocator<Block>::allocate(const utils::SourceLocation& location)
+{
+    return utils::newMemory<Block>(1, location);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Block>
+Block* Heap::Allocator<Block>::reallocate(Block* block, const size_t, 
+                                          const size_t newSize,
+                                          const utils::SourceLocation& location)
+{
+    return utils::reallocMemory<Block>(block, newSize, location);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Block>
+void Heap::Allocator<Block>::deallocate(Block* block) { utils::deleteMemory(block); }
+
+// -----------------------------------------------------------------------------
+template <auto& Source>
+template <typename Block>
+Block* Monotonic<Source>::Allocator<Block>::allocate()
+{
+    return static_cast<Block*>(Source.allocate(sizeof(Block), alignof(Block)));
+}
+
+// -----------------------------------------------------------------------------
+template <auto& Source>
+template <typename Block>
+Block* Monotonic<Source>::Allocator<Block>::reallocate(Block* block, 
+                                                       const size_t oldSize,
+                                                       const size_t newSize)
+{
+    return static_cast<Block*>(Source.reallocate(block, sizeof(Block) * oldSize, 
+                                                 sizeof(Block) * newSize, 
+                                                 alignof(Block)));
+}
+
+// -----------------------------------------------------------------------------
+template <auto& Source>
+template <typename Block>
+void Monotonic<Source>::Allocator<Block>::deallocate(Block*) {}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBlocks, bool Growable>
+template <typename Block>
+Pool<NumBlocks, Growable>::Allocator<Block>::~Allocator()
+{
+    while (mySlabs != nullptr)
+    {
+        auto next{mySlabs->next};
+        utils::deleteMemory(mySlabs);
+        mySlabs = next;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBlocks, bool Growable>
+template <typename Block>
+Block* Pool<NumBlocks, Growable>::Allocator<Block>::allocate(
+    const utils::SourceLocation& location)
+{
+    if (myFreeList == nullptr && myNumUnused > 0)
+    {
+        return reinterpret_cast<Block*>(&mySlots[NumBlocks - myNumUnused--]);
+    }
+    if (myFreeList == nullptr && !(Growable && grow(location))) { return nullptr; }
+    auto slot{myFreeList};
+    myFreeList = slot->next;
+    return reinterpret_cast<Block*>(slot);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBlocks, bool Growable>
+template <typename Block>
+void Pool<NumBlocks, Growable>::Allocator<Block>::deallocate(Block* block)
+{
+    if (block == nullptr) { return; }
+    auto slot{reinterpret_cast<Slot*>(block)};
+    slot->next = myFreeList;
+    myFreeList = slot;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBlocks, bool Growable>
+template <typename Block>
+bool Pool<NumBlocks, Growable>::Allocator<Block>::grow(const utils::SourceLocation& location)
+{
+    auto slab{utils::newMemory<Slab>(1, location)};
+    if (slab == nullptr) { return false; }
+    slab->next = mySlabs;
+    mySlabs = slab;
+
+    for (size_t i{}; i < NumBlocks; ++i)
+    {
+        slab->slots[i].next = myFreeList;
+        myFreeList = &slab->slots[i];
+    }
+    return true;
+}
+
+} // namespace allocation
+} // namespace container
\ No newline at end of file
@@ -0,0 +1,150 @@
+/********************************************************************************
+ * @brief Implementation of monotonic arenas, from which memory is allocated
+ *        by bumping an offset into a statically reserved buffer.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace container
+{
+namespace allocation
+{
+
+/********************************************************************************
+ * @brief Class for implementation of monotonic (bump) arenas. Allocation is
+ *        performed by bumping an offset and memory is only returned to the
+ *        arena in bulk, either by releasing everything allocated since a
+ *        marker or by resetting the arena. This suits buffers that live
+ *        exactly as long as one processing cycle:
+ *
+ *            const auto marker{arena.mark()};
+ *            // Allocate the buffers of the cycle...
+ *            arena.release(marker);
+ *
+ *        An arena can be used as a container allocation policy via
+ *        allocation::Monotonic, see allocation.h.
+ *
+ * @tparam Size The size of the arena in bytes.
+ *
+ * @note Containers using memory above a marker must not be used after the
+ *       marker has been released, since the memory will be handed out again.
+ *       The arena size must exceed 0, else a compilation error will be
+ *       generated.
+ ********************************************************************************/
+template <size_t Size>
+class Arena
+{
+public:
+    /********************************************************************************
+     * @brief Marker used for releasing memory allocated after a given point.
+     ********************************************************************************/
+    using Marker = size_t;
+
+    /********************************************************************************
+     * @brief Creates new arena. The arena is fully available.
+     ********************************************************************************/
+    Arena();
+
+    /********************************************************************************
+     * @brief Deletes arena.
+     ********************************************************************************/
+    ~Arena();
+
+    /********************************************************************************
+     * @brief Copy constructor deleted.
+     ********************************************************************************/
+    Arena(Arena&) = delete;
+
+    /********************************************************************************
+     * @brief Assignment operator deleted.
+     ********************************************************************************/
+    Arena& operator=(Arena&) = delete;
+
+    /********************************************************************************
+     * @brief Move constructor deleted.
+     ********************************************************************************/
+    Arena(Arena&&) = delete;
+
+    /********************************************************************************
+     * @brief Allocates a block of specified size from the arena.
+     *
+     * @param size      The size of the block in bytes.
+     * @param alignment The alignment of the block in bytes, must be a power of
+     *                  two (default = 1).
+     *
+     * @return A pointer to the allocated block at success, else a null pointer
+     *         if the arena is exhausted.
+     ********************************************************************************/
+    void* allocate(const size_t size, const size_t alignment = 1);
+
+    /********************************************************************************
+     * @brief Resizes specified block. The most recently allocated block is
+     *        resized in place unless a marker has been taken after it was
+     *        allocated, other blocks are copied to a new block. The memory of
+     *        the old block isn't reclaimed until it's released.
+     *
+     * @param block     Pointer to the block to resize (may be null).
+     * @param oldSize   The current size of the block in bytes.
+     * @param newSize   The new size of the block in bytes.
+     * @param alignment The alignment of the block in bytes (default = 1).
+     *
+     * @return A pointer to the resized block at success, else a null pointer
+     *         if the arena is exhausted, in which case the block is unchanged.
+     ********************************************************************************/
+    void* reallocate(void* block, const size_t oldSize, const size_t newSize,
+                     const size_t alignment = 1);
+
+    /********************************************************************************
+     * @brief Provides a marker for the current position of the arena.
+     *
+     * @return The marker.
+     *
+     * @note Blocks allocated before the most recent marker are never resized
+     *       in place, since growing them would extend them above the marker
+     *       and releasing the marker would hand out their memory again. They
+     *       are instead copied to a new block, so a container allocated
+     *       before the marker and grown after it must not be used once the
+     *       marker has been released.
+     ********************************************************************************/
+    Marker mark();
+
+    /********************************************************************************
+     * @brief Releases all memory allocated after specified marker was taken.
+     *
+     * @param marker The marker to return to.
+     ********************************************************************************/
+    void release(const Marker marker);
+
+    /********************************************************************************
+     * @brief Releases all memory allocated from the arena.
+     ********************************************************************************/
+    void reset();
+
+    /********************************************************************************
+     * @brief Returns the number of bytes currently allocated from the arena.
+     *
+     * @return The number of allocated bytes.
+     ********************************************************************************/
+    size_t used() const;
+
+    /********************************************************************************
+     * @brief Returns the size of the arena.
+     *
+     * @return The size of the arena in bytes.
+     ********************************************************************************/
+    static constexpr size_t capacity();
+
+private:
+    static_assert(Size > 0, "Arena size cannot be set to 0!");
+
+    alignas(__BIGGEST_ALIGNMENT__) uint8_t myBuffer[Size]{};
+    size_t myOffset{};
+    size_t myLastOffset{Size};
+};
+
+} // namespace allocation
+} // namespace container
+
+#include "arena_impl.h"
\ No newline at end of file
@@ -0,0 +1,86 @@
+/********************************************************************************
+ * @brief Implementation details for the container::allocation::Arena class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+#include <string.h>
+
+namespace container
+{
+namespace allocation
+{
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+Arena<Size>::Arena() = default;
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+Arena<Size>::~Arena() = default;
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+void* Arena<Size>::allocate(const size_t size, const size_t alignment)
+{
+    const size_t offset{(myOffset + alignment - 1) & ~(alignment - 1)};
+    if (offset > Size || size > Size - offset) { return nullptr; }
+    myLastOffset = offset;
+    myOffset = offset + size;
+    return myBuffer + offset;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+void* Arena<Size>::reallocate(void* block, const size_t oldSize,
+                              const size_t newSize, const size_t alignment)
+{
+    if (block == nullptr) { return allocate(newSize, alignment); }
+
+    if (block == myBuffer + myLastOffset)
+    {
+        if (newSize > Size - myLastOffset) { return nullptr; }
+        myOffset = myLastOffset + newSize;
+        return block;
+    }
+
+    auto newBlock{allocate(newSize, alignment)};
+    if (newBlock == nullptr) { return nullptr; }
+    memcpy(newBlock, block, oldSize < newSize ? oldSize : newSize);
+    return newBlock;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+typename Arena<Size>::Marker Arena<Size>::mark() 
+{ 
+    // Forget the last block, so that blocks allocated before the marker are
+    // never grown above it.
+    myLastOffset = Size;
+    return myOffset; 
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+void Arena<Size>::release(const Marker marker)
+{
+    if (marker >= myOffset) { return; }
+    myOffset = marker;
+    myLastOffset = Size;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+void Arena<Size>::reset() { release(0); }
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+size_t Arena<Size>::used() const { return myOffset; }
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+constexpr size_t Arena<Size>::capacity() { return Size; }
+
+} // namespace allocation
+} // namespace container
\ No newline at end of file
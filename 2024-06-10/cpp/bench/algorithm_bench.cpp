@@ -0,0 +1,211 @@
+/********************************************************************************
+ * @brief Checks and benchmarks of the algorithms in algorithm.h against the
+ *        naive versions they replace.
+ *
+ * @note The naive versions are the hand-rolled loops used before algorithm.h
+ *       existed: insertion sort, a linear search, selection by sorting and
+ *       element-wise fill and copy loops. std::sort is also reported as a
+ *       reference for the sort. The gate checks the results and that every
+ *       algorithm is at least as fast as its naive version at 256 elements
+ *       and more.
+ ********************************************************************************/
+#include <stdio.h>
+
+#include <algorithm>
+
+#include "../algorithm.h"
+#include "../array.h"
+#include "../vector.h"
+#include "bench.h"
+
+namespace
+{
+
+constexpr size_t MaxSize{4096};
+
+bench::Gate gate{};
+uint16_t input[MaxSize]{};
+uint16_t work[MaxSize]{};
+
+// -----------------------------------------------------------------------------
+void insertionSort(uint16_t* first, uint16_t* last)
+{
+    for (auto i{first + 1}; i < last; ++i)
+    {
+        const auto value{*i};
+        auto j{i};
+        for (; j > first && value < *(j - 1); --j) { *j = *(j - 1); }
+        *j = value;
+    }
+}
+
+// -----------------------------------------------------------------------------
+const uint16_t* linearSearch(const uint16_t* first, const uint16_t* last, const uint16_t value)
+{
+    for (; first < last && *first < value; ++first) {}
+    return first;
+}
+
+// -----------------------------------------------------------------------------
+void checkResults()
+{
+    bool sorted{true}, selected{true}, bounded{true};
+    for (size_t size{1}; size <= 300; ++size)
+    {
+        for (size_t i{}; i < size; ++i) { work[i] = input[i] % 64U; }
+        uint16_t reference[MaxSize]{};
+        std::copy(work, work + size, reference);
+        std::sort(reference, reference + size);
+
+        container::sort(work, work + size);
+        sorted = sorted && std::equal(work, work + size, reference);
+
+        for (size_t i{}; i < size; ++i) { work[i] = input[i] % 64U; }
+        const auto nth{size / 3};
+        container::nthElement(work, work + nth, work + size);
+        selected = selected && work[nth] == reference[nth] &&
+                   std::all_of(work, work + nth, [&](auto v) { return v <= work[nth]; }) &&
+                   std::all_of(work + nth, work + size, [&](auto v) { return v >= work[nth]; });
+
+        for (uint16_t value{}; value < 66U; ++value)
+        {
+            bounded = bounded &&
+                container::lowerBound(reference, reference + size, value) ==
+                    std::lower_bound(reference, reference + size, value) &&
+                container::upperBound(reference, reference + size, value) ==
+                    std::upper_bound(reference, reference + size, value) &&
+                container::binarySearch(reference, reference + size, value) ==
+                    std::binary_search(reference, reference + size, value);
+        }
+    }
+    gate.check("sort matches std::sort for 1 - 300 elements", sorted);
+    gate.check("nthElement places the nth element for 1 - 300 elements", selected);
+    gate.check("lowerBound, upperBound and binarySearch match std::", bounded);
+
+    container::Array<int, 6> array{5, 1, 9, 3, 9, 1};
+    container::Vector<int> vector{5, 1, 9, 3, 9, 1};
+    gate.check("minElement and maxElement of Array find 1 and 9",
+               *container::minElement(array.begin(), array.end()) == 1 &&
+               *container::maxElement(array.begin(), array.end()) == 9);
+    gate.check("minElement and maxElement of Vector find 1 and 9",
+               *container::minElement(vector.begin(), vector.end()) == 1 &&
+               *container::maxElement(vector.begin(), vector.end()) == 9);
+
+    uint8_t bytes[64]{};
+    container::fill(bytes, bytes + 64, static_cast<uint8_t>(0xA5));
+    uint16_t words[64]{};
+    container::copy(input, input + 64, words);
+    gate.check("fill and copy write every element",
+               std::all_of(bytes, bytes + 64, [](auto v) { return v == 0xA5; }) &&
+               std::equal(words, words + 64, input));
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+void benchmark()
+{
+    char name[64]{};
+    const auto sort{bench::measure([]
+    {
+        std::copy(input, input + Size, work);
+        container::sort(work, work + Size);
+        bench::keep(work);
+    }, Size)};
+    const auto naiveSort{bench::measure([]
+    {
+        std::copy(input, input + Size, work);
+        insertionSort(work, work + Size);
+        bench::keep(work);
+    }, Size)};
+    const auto stdSort{bench::measure([]
+    {
+        std::copy(input, input + Size, work);
+        std::sort(work, work + Size);
+        bench::keep(work);
+    }, Size)};
+    snprintf(name, sizeof(name), "sort %zu (vs insertion sort)", Size);
+    bench::print(name, sort, naiveSort);
+    if (Size >= 256) { gate.checkRatio(name, sort, naiveSort, 1.0); }
+    snprintf(name, sizeof(name), "sort %zu (vs std::sort)", Size);
+    bench::print(name, sort, stdSort);
+    gate.checkRatio(name, sort, stdSort, 3.0);
+
+    const auto nth{bench::measure([]
+    {
+        std::copy(input, input + Size, work);
+        container::nthElement(work, work + Size / 2, work + Size);
+        bench::keep(work);
+    }, Size)};
+    snprintf(name, sizeof(name), "nthElement %zu (vs insertion sort)", Size);
+    bench::print(name, nth, naiveSort);
+    if (Size >= 256) { gate.checkRatio(name, nth, naiveSort, 1.0); }
+
+    std::copy(input, input + Size, work);
+    std::sort(work, work + Size);
+    const auto search{bench::measure([]
+    {
+        uint32_t sum{};
+        for (size_t i{}; i < Size; ++i) { sum += *container::lowerBound(work, work + Size - 1, input[i]); }
+        bench::keep(sum);
+    }, Size)};
+    const auto linear{bench::measure([]
+    {
+        uint32_t sum{};
+        for (size_t i{}; i < Size; ++i) { sum += *linearSearch(work, work + Size - 1, input[i]); }
+        bench::keep(sum);
+    }, Size)};
+    snprintf(name, sizeof(name), "lowerBound %zu (vs linear search)", Size);
+    bench::print(name, search, linear);
+    if (Size >= 256) { gate.checkRatio(name, search, linear, 1.0); }
+
+    static uint8_t bytes[MaxSize]{};
+    const auto fill{bench::measure([]
+    {
+        container::fill(bytes, bytes + Size, static_cast<uint8_t>(0x55));
+        bench::keep(bytes);
+    }, Size)};
+    const auto fillLoop{bench::measure([]
+    {
+        for (size_t i{}; i < Size; ++i)
+        {
+            // Keep the loop from being turned into memset by the compiler.
+            bench::keep(bytes[i] = 0x55);
+        }
+    }, Size)};
+    snprintf(name, sizeof(name), "fill %zu bytes (vs loop)", Size);
+    bench::print(name, fill, fillLoop);
+    if (Size >= 256) { gate.checkRatio(name, fill, fillLoop, 1.0); }
+
+    const auto copy{bench::measure([]
+    {
+        container::copy(input, input + Size, work);
+        bench::keep(work);
+    }, Size)};
+    const auto copyLoop{bench::measure([]
+    {
+        for (size_t i{}; i < Size; ++i) { bench::keep(work[i] = input[i]); }
+    }, Size)};
+    snprintf(name, sizeof(name), "copy %zu words (vs loop)", Size);
+    bench::print(name, copy, copyLoop);
+    if (Size >= 256) { gate.checkRatio(name, copy, copyLoop, 1.0); }
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    uint32_t seed{7U};
+    for (auto& value : input)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        value = static_cast<uint16_t>(seed >> 16U);
+    }
+
+    checkResults();
+    bench::printHeader("Algorithms against naive versions (baseline)");
+    benchmark<16>();
+    benchmark<256>();
+    benchmark<4096>();
+    return gate.result();
+}
@@ -0,0 +1,123 @@
+/********************************************************************************
+ * @brief Implementation details of the host benchmark harness.
+ ********************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+namespace
+{
+
+uint32_t numAllocations{};
+
+} // namespace
+
+/********************************************************************************
+ * @note The allocation functions of glibc are replaced by counting wrappers, so
+ *       that allocations via utils::newMemory (malloc) and via std::allocator
+ *       (operator new, which calls malloc) are counted alike.
+ ********************************************************************************/
+extern "C"
+{
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* block, size_t size);
+void __libc_free(void* block);
+
+// -----------------------------------------------------------------------------
+void* malloc(size_t size)
+{
+    numAllocations++;
+    return __libc_malloc(size);
+}
+
+// -----------------------------------------------------------------------------
+void* calloc(size_t count, size_t size)
+{
+    numAllocations++;
+    return __libc_calloc(count, size);
+}
+
+// -----------------------------------------------------------------------------
+void* realloc(void* block, size_t size)
+{
+    numAllocations++;
+    return __libc_realloc(block, size);
+}
+
+// -----------------------------------------------------------------------------
+void free(void* block) { __libc_free(block); }
+}
+
+namespace bench
+{
+
+// -----------------------------------------------------------------------------
+uint32_t allocationCount() { return numAllocations; }
+
+// -----------------------------------------------------------------------------
+void printHeader(const char* title)
+{
+    printf("\n%s\n", title);
+    printf("%-40s %10s %10s %7s | %10s %7s | %6s\n", "workload", "ns/op", "Mops/s",
+           "allocs", "base ns/op", "allocs", "ratio");
+}
+
+// -----------------------------------------------------------------------------
+void print(const char* name, const Measurement& measured, const Measurement& baseline)
+{
+    printf("%-40s %10.2f %10.2f %7u | %10.2f %7u | %6.2f\n", name, measured.nsPerOp,
+           1000.0 / measured.nsPerOp, static_cast<unsigned>(measured.allocations),
+           baseline.nsPerOp, static_cast<unsigned>(baseline.allocations),
+           measured.nsPerOp / baseline.nsPerOp);
+}
+
+// -----------------------------------------------------------------------------
+void Gate::checkRatio(const char* name, const Measurement& measured,
+                      const Measurement& baseline, const double maxRatio)
+{
+    const auto ratio{measured.nsPerOp / baseline.nsPerOp};
+    if (ratio > maxRatio)
+    {
+        printf("FAILED: %s is %.2f times slower than the baseline (max %.2f)\n",
+               name, ratio, maxRatio);
+        myNumFailures++;
+    }
+    myNumChecks++;
+}
+
+// -----------------------------------------------------------------------------
+void Gate::checkAllocations(const char* name, const Measurement& measured,
+                            const uint32_t maxAllocations)
+{
+    if (measured.allocations > maxAllocations)
+    {
+        printf("FAILED: %s performs %u allocations (max %u)\n", name,
+               static_cast<unsigned>(measured.allocations),
+               static_cast<unsigned>(maxAllocations));
+        myNumFailures++;
+    }
+    myNumChecks++;
+}
+
+// -----------------------------------------------------------------------------
+void Gate::check(const char* name, const bool condition)
+{
+    if (!condition)
+    {
+        printf("FAILED: %s\n", name);
+        myNumFailures++;
+    }
+    myNumChecks++;
+}
+
+// -----------------------------------------------------------------------------
+int Gate::result() const
+{
+    printf("\n%u of %u checks passed\n", static_cast<unsigned>(myNumChecks - myNumFailures),
+           static_cast<unsigned>(myNumChecks));
+    return myNumFailures == 0 ? 0 : 1;
+}
+
+} // namespace bench
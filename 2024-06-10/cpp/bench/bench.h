@@ -0,0 +1,156 @@
+/********************************************************************************
+ * @brief Minimal harness for host benchmarks of the containers and utilities.
+ *
+ * @note Host only, see CMakeLists.txt in this directory. Every benchmark
+ *       measures a workload of the repository next to a baseline, typically
+ *       the corresponding std:: container, and reports the time per operation,
+ *       the throughput and the number of heap allocations. Checks passed to
+ *       bench::Gate make the benchmark fail, so that ctest reports
+ *       regressions.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+
+namespace bench
+{
+
+/********************************************************************************
+ * @brief Structure holding the result of a measured workload.
+ *
+ * @param nsPerOp     The time per operation in nanoseconds (fastest run).
+ * @param allocations The number of heap allocations per run, where calls to
+ *                    malloc, calloc and realloc (and thereby operator new)
+ *                    are counted.
+ ********************************************************************************/
+struct Measurement
+{
+    double nsPerOp;
+    uint32_t allocations;
+};
+
+/********************************************************************************
+ * @brief Prevents the compiler from optimizing away the computation of
+ *        referenced value.
+ *
+ * @param value Reference to the value to keep.
+ ********************************************************************************/
+template <typename T>
+inline void keep(const T& value) { asm volatile("" : : "g"(&value) : "memory"); }
+
+/********************************************************************************
+ * @brief Provides the number of heap allocations performed by the process.
+ *
+ * @return The number of calls to malloc, calloc and realloc so far.
+ ********************************************************************************/
+uint32_t allocationCount();
+
+/********************************************************************************
+ * @brief Measures specified workload. The workload is run once to count its
+ *        allocations and then repeatedly for at least 20 ms, where the fastest
+ *        run is kept.
+ *
+ * @tparam Workload Callable type without parameters.
+ *
+ * @param workload  The workload to measure.
+ * @param opsPerRun The number of operations performed by each run.
+ *
+ * @return The measurement.
+ ********************************************************************************/
+template <typename Workload>
+Measurement measure(Workload&& workload, const size_t opsPerRun);
+
+/********************************************************************************
+ * @brief Prints a heading followed by the column titles of print.
+ *
+ * @param title The title of the benchmark.
+ ********************************************************************************/
+void printHeader(const char* title);
+
+/********************************************************************************
+ * @brief Prints a measured workload next to its baseline.
+ *
+ * @param name     The name of the workload.
+ * @param measured The measurement of the workload.
+ * @param baseline The measurement of the baseline.
+ ********************************************************************************/
+void print(const char* name, const Measurement& measured, const Measurement& baseline);
+
+/********************************************************************************
+ * @brief Class collecting the checks of a benchmark. The benchmark fails if
+ *        any check fails.
+ ********************************************************************************/
+class Gate
+{
+public:
+    /********************************************************************************
+     * @brief Checks that a workload is at most specified number of times slower
+     *        than its baseline.
+     *
+     * @param name     The name of the workload.
+     * @param measured The measurement of the workload.
+     * @param baseline The measurement of the baseline.
+     * @param maxRatio The highest allowed ratio between the times per operation.
+     ********************************************************************************/
+    void checkRatio(const char* name, const Measurement& measured,
+                    const Measurement& baseline, const double maxRatio);
+
+    /********************************************************************************
+     * @brief Checks that a workload performs at most specified number of
+     *        allocations per run.
+     *
+     * @param name           The name of the workload.
+     * @param measured       The measurement of the workload.
+     * @param maxAllocations The highest allowed number of allocations.
+     ********************************************************************************/
+    void checkAllocations(const char* name, const Measurement& measured,
+                          const uint32_t maxAllocations);
+
+    /********************************************************************************
+     * @brief Checks specified condition.
+     *
+     * @param name      Description of the checked condition.
+     * @param condition The condition to check.
+     ********************************************************************************/
+    void check(const char* name, const bool condition);
+
+    /********************************************************************************
+     * @brief Prints the number of failed checks.
+     *
+     * @return The exit code of the benchmark, i.e. 0 if all checks passed.
+     ********************************************************************************/
+    int result() const;
+
+private:
+    uint16_t myNumChecks{};
+    uint16_t myNumFailures{};
+};
+
+// -----------------------------------------------------------------------------
+template <typename Workload>
+Measurement measure(Workload&& workload, const size_t opsPerRun)
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr auto MinDuration{std::chrono::milliseconds{20}};
+    constexpr uint8_t MinRuns{5};
+
+    const auto allocationsBefore{allocationCount()};
+    workload();
+    Measurement result{0.0, allocationCount() - allocationsBefore};
+
+    const auto start{Clock::now()};
+    for (uint32_t run{}; run < MinRuns || Clock::now() - start < MinDuration; ++run)
+    {
+        const auto runStart{Clock::now()};
+        workload();
+        const std::chrono::duration<double, std::nano> elapsed{Clock::now() - runStart};
+        const auto nsPerOp{elapsed.count() / static_cast<double>(opsPerRun)};
+        if (run == 0 || nsPerOp < result.nsPerOp) { result.nsPerOp = nsPerOp; }
+    }
+    return result;
+}
+
+} // namespace bench
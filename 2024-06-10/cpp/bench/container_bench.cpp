@@ -0,0 +1,367 @@
+/********************************************************************************
+ * @brief Benchmarks of container::Vector, container::List, container::Array
+ *        and container::CallbackArray against std::vector, std::list and
+ *        std::array.
+ *
+ * @note Each workload is run for several sizes and element types. The gate
+ *       fails if a container is more than MaxSlowdown times slower than its
+ *       std:: counterpart, which catches complexity regressions rather than
+ *       small differences, or if it allocates more often than expected.
+ *       The element lifetimes of container::StaticVector are checked with an
+ *       element type without default constructor, and arena markers with a
+ *       vector growing across a marker.
+ ********************************************************************************/
+#include <stdio.h>
+
+#include <array>
+#include <list>
+#include <vector>
+
+#include "../arena.h"
+#include "../array.h"
+#include "../callback_array.h"
+#include "../list.h"
+#include "../static_vector.h"
+#include "../vector.h"
+#include "bench.h"
+
+namespace
+{
+
+constexpr double MaxSlowdown{10.0};
+
+bench::Gate gate{};
+container::allocation::Arena<256> arena{};
+volatile uint32_t numCalls{};
+
+// -----------------------------------------------------------------------------
+void callback() { numCalls = numCalls + 1; }
+
+// -----------------------------------------------------------------------------
+void report(const char* container, const char* workload, const char* type,
+            const size_t size, const bench::Measurement& measured,
+            const bench::Measurement& baseline)
+{
+    char name[64]{};
+    snprintf(name, sizeof(name), "%s<%s> %s %zu", container, type, workload, size);
+    bench::print(name, measured, baseline);
+    gate.checkRatio(name, measured, baseline, MaxSlowdown);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void benchmarkVector(const char* type)
+{
+    const auto push{bench::measure([]
+    {
+        container::Vector<T> vector{};
+        for (size_t i{}; i < Size; ++i) { vector.pushBack(static_cast<T>(i)); }
+        bench::keep(vector);
+    }, Size)};
+    const auto stdPush{bench::measure([]
+    {
+        std::vector<T> vector{};
+        for (size_t i{}; i < Size; ++i) { vector.push_back(static_cast<T>(i)); }
+        bench::keep(vector);
+    }, Size)};
+    report("Vector", "push", type, Size, push, stdPush);
+
+    // Geometric growth must allocate no more often than std::vector.
+    gate.checkAllocations("Vector push", push, stdPush.allocations);
+
+    container::Vector<T> source{};
+    std::vector<T> stdSource{};
+    for (size_t i{}; i < Size; ++i)
+    {
+        source.pushBack(static_cast<T>(i));
+        stdSource.push_back(static_cast<T>(i));
+    }
+
+    const auto iterate{bench::measure([&]
+    {
+        uint32_t sum{};
+        for (const auto& value : source) { sum += value; }
+        bench::keep(sum);
+    }, Size)};
+    const auto stdIterate{bench::measure([&]
+    {
+        uint32_t sum{};
+        for (const auto& value : stdSource) { sum += value; }
+        bench::keep(sum);
+    }, Size)};
+    report("Vector", "iterate", type, Size, iterate, stdIterate);
+
+    const auto copy{bench::measure([&]
+    {
+        container::Vector<T> vector{source};
+        bench::keep(vector);
+    }, Size)};
+    const auto stdCopy{bench::measure([&]
+    {
+        std::vector<T> vector{stdSource};
+        bench::keep(vector);
+    }, Size)};
+    report("Vector", "copy", type, Size, copy, stdCopy);
+    gate.checkAllocations("Vector copy", copy, 1U);
+
+    container::Vector<T> vector{};
+    std::vector<T> stdVector{};
+    const auto clear{bench::measure([&]
+    {
+        for (size_t i{}; i < Size; ++i) { vector.pushBack(static_cast<T>(i)); }
+        vector.clear();
+    }, Size)};
+    const auto stdClear{bench::measure([&]
+    {
+        for (size_t i{}; i < Size; ++i) { stdVector.push_back(static_cast<T>(i)); }
+        stdVector.clear();
+    }, Size)};
+    report("Vector", "push + clear", type, Size, clear, stdClear);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void benchmarkList(const char* type)
+{
+    const auto push{bench::measure([]
+    {
+        container::List<T> list{};
+        for (size_t i{}; i < Size; ++i) { list.pushBack(static_cast<T>(i)); }
+        bench::keep(list);
+    }, Size)};
+    const auto stdPush{bench::measure([]
+    {
+        std::list<T> list{};
+        for (size_t i{}; i < Size; ++i) { list.push_back(static_cast<T>(i)); }
+        bench::keep(list);
+    }, Size)};
+    report("List", "push", type, Size, push, stdPush);
+    gate.checkAllocations("List push", push, Size);
+
+    // Insert every value in front of the last node, i.e. in the middle of the list.
+    const auto insert{bench::measure([]
+    {
+        container::List<T> list{};
+        list.pushBack(T{});
+        list.pushBack(T{});
+        for (size_t i{}; i < Size; ++i)
+        {
+            auto last{list.rbegin()};
+            list.insert(last, static_cast<T>(i));
+        }
+        bench::keep(list);
+    }, Size)};
+    const auto stdInsert{bench::measure([]
+    {
+        std::list<T> list{T{}, T{}};
+        for (size_t i{}; i < Size; ++i) { list.insert(std::prev(list.end()), static_cast<T>(i)); }
+        bench::keep(list);
+    }, Size)};
+    report("List", "insert", type, Size, insert, stdInsert);
+
+    container::List<T> source{};
+    std::list<T> stdSource{};
+    for (size_t i{}; i < Size; ++i)
+    {
+        source.pushBack(static_cast<T>(i));
+        stdSource.push_back(static_cast<T>(i));
+    }
+
+    const auto iterate{bench::measure([&]
+    {
+        uint32_t sum{};
+        for (auto i{source.begin()}; i != source.end(); ++i) { sum += *i; }
+        bench::keep(sum);
+    }, Size)};
+    const auto stdIterate{bench::measure([&]
+    {
+        uint32_t sum{};
+        for (const auto& value : stdSource) { sum += value; }
+        bench::keep(sum);
+    }, Size)};
+    report("List", "iterate", type, Size, iterate, stdIterate);
+
+    const auto copy{bench::measure([&]
+    {
+        container::List<T> list{source};
+        bench::keep(list);
+    }, Size)};
+    const auto stdCopy{bench::measure([&]
+    {
+        std::list<T> list{stdSource};
+        bench::keep(list);
+    }, Size)};
+    report("List", "copy", type, Size, copy, stdCopy);
+
+    container::List<T> list{};
+    std::list<T> stdList{};
+    const auto clear{bench::measure([&]
+    {
+        for (size_t i{}; i < Size; ++i) { list.pushBack(static_cast<T>(i)); }
+        list.clear();
+    }, Size)};
+    const auto stdClear{bench::measure([&]
+    {
+        for (size_t i{}; i < Size; ++i) { stdList.push_back(static_cast<T>(i)); }
+        stdList.clear();
+    }, Size)};
+    report("List", "push + clear", type, Size, clear, stdClear);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void benchmarkArray(const char* type)
+{
+    container::Array<T, Size> source{};
+    std::array<T, Size> stdSource{};
+    for (size_t i{}; i < Size; ++i)
+    {
+        source[i] = static_cast<T>(i);
+        stdSource[i] = static_cast<T>(i);
+    }
+
+    const auto iterate{bench::measure([&]
+    {
+        uint32_t sum{};
+        for (const auto& value : source) { sum += value; }
+        bench::keep(sum);
+    }, Size)};
+    const auto stdIterate{bench::measure([&]
+    {
+        uint32_t sum{};
+        for (const auto& value : stdSource) { sum += value; }
+        bench::keep(sum);
+    }, Size)};
+    report("Array", "iterate", type, Size, iterate, stdIterate);
+
+    container::Array<T, Size> array{};
+    std::array<T, Size> stdArray{};
+    const auto copy{bench::measure([&]
+    {
+        array = source;
+        bench::keep(array);
+    }, Size)};
+    const auto stdCopy{bench::measure([&]
+    {
+        stdArray = stdSource;
+        bench::keep(stdArray);
+    }, Size)};
+    report("Array", "copy", type, Size, copy, stdCopy);
+
+    const auto clear{bench::measure([&]
+    {
+        array.clear();
+        bench::keep(array);
+    }, Size)};
+    const auto stdClear{bench::measure([&]
+    {
+        stdArray.fill(T{});
+        bench::keep(stdArray);
+    }, Size)};
+    report("Array", "clear", type, Size, clear, stdClear);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+void benchmarkCallbackArray()
+{
+    container::CallbackArray<Size> callbacks{};
+    std::array<void (*)(), Size> stdCallbacks{};
+
+    const auto call{bench::measure([&]
+    {
+        for (size_t i{}; i < Size; ++i) { callbacks.add(callback, i); }
+        for (size_t i{}; i < Size; ++i) { callbacks.call(i); }
+        for (size_t i{}; i < Size; ++i) { callbacks.remove(i); }
+    }, Size)};
+    const auto stdCall{bench::measure([&]
+    {
+        for (size_t i{}; i < Size; ++i) { stdCallbacks[i] = callback; }
+        for (size_t i{}; i < Size; ++i)
+        {
+            if (stdCallbacks[i] != nullptr) { stdCallbacks[i](); }
+        }
+        for (size_t i{}; i < Size; ++i) { stdCallbacks[i] = nullptr; }
+    }, Size)};
+    report("CallbackArray", "add + call + remove", "fn", Size, call, stdCall);
+}
+
+/********************************************************************************
+ * @brief Element without default constructor, counting the live elements.
+ ********************************************************************************/
+struct Tracked
+{
+    static int numLive;
+    uint8_t value;
+
+    explicit Tracked(const uint8_t value) : value{value} { ++numLive; }
+    Tracked(const Tracked& other) : value{other.value} { ++numLive; }
+    ~Tracked() { --numLive; }
+    Tracked& operator=(const Tracked& other) = default;
+};
+
+int Tracked::numLive{};
+
+// -----------------------------------------------------------------------------
+void checkStaticVector()
+{
+    {
+        container::StaticVector<Tracked, 8> vector{};
+        for (uint8_t i{}; i < 4U; ++i) { vector.emplaceBack(i); }
+        vector.pushBack(Tracked{4U});
+        vector.popBack();
+        auto copy{vector};
+        gate.check("StaticVector constructs elements in place",
+                   Tracked::numLive == 8 && copy.size() == 4U && copy[3].value == 3U);
+        copy.clear();
+        gate.check("StaticVector destroys removed elements", Tracked::numLive == 4);
+    }
+    gate.check("StaticVector destroys its elements", Tracked::numLive == 0);
+}
+
+// -----------------------------------------------------------------------------
+void checkArena()
+{
+    container::Vector<uint8_t, container::allocation::Monotonic<arena>> vector{};
+    vector.pushBack(1U);
+    const auto marker{arena.mark()};
+    const auto block{vector.data()};
+    // Fill the vector and push once more, so that it has to grow.
+    while (vector.size() < vector.capacity()) { vector.pushBack(2U); }
+    vector.pushBack(2U);
+    gate.check("Arena doesn't grow a block across the last marker",
+               vector.data() != block && block[0] == 1U);
+    arena.release(marker);
+    gate.check("Arena keeps the blocks allocated before the marker",
+               arena.used() == marker && block[0] == 1U);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void benchmarkType(const char* type)
+{
+    benchmarkVector<T, 16>(type);
+    benchmarkVector<T, 256>(type);
+    benchmarkVector<T, 4096>(type);
+    benchmarkList<T, 16>(type);
+    benchmarkList<T, 256>(type);
+    benchmarkList<T, 4096>(type);
+    benchmarkArray<T, 16>(type);
+    benchmarkArray<T, 256>(type);
+    benchmarkArray<T, 4096>(type);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    bench::printHeader("Containers against std:: (baseline)");
+    benchmarkType<uint8_t>("uint8_t");
+    benchmarkType<uint32_t>("uint32_t");
+    benchmarkCallbackArray<8>();
+    benchmarkCallbackArray<64>();
+    checkStaticVector();
+    checkArena();
+    return gate.result();
+}
@@ -0,0 +1,166 @@
+/********************************************************************************
+ * @brief Benchmark of the block copies of trivially copyable elements in the
+ *        containers on 256-byte buffers.
+ *
+ * @note The baseline stores the same bytes in a wrapper with a user-provided
+ *       copy assignment. The wrapper isn't trivially copyable, so the containers
+ *       copy it element by element, i.e. the way every element type was copied
+ *       before utils::copyElements existed. The gate checks the copied values
+ *       and that the block copies are at least as fast. The benchmark is built
+ *       at -Os like the firmware, since higher levels vectorize the element
+ *       loops into block copies as well. The figures are host figures and
+ *       don't predict the speedup on the ATmega328P. One operation is one
+ *       copy of 256 bytes.
+ ********************************************************************************/
+// Vector moves its elements with realloc. That is safe for Element, whose copy
+// operations only copy the value, so the warning about it is disabled.
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+
+#include <stdio.h>
+
+#include "../array.h"
+#include "../static_vector.h"
+#include "../vector.h"
+#include "bench.h"
+
+namespace
+{
+
+constexpr size_t NumBytes{256};
+
+bench::Gate gate{};
+
+/********************************************************************************
+ * @brief Element holding a value of type T, copied element by element by the
+ *        containers due to its user-provided copy assignment.
+ ********************************************************************************/
+template <typename T>
+struct Element
+{
+    T value{};
+
+    Element() = default;
+    Element(const T value) : value{value} {}
+    Element(const Element& other) : value{other.value} {}
+    Element& operator=(const Element& other)
+    {
+        value = other.value;
+        return *this;
+    }
+    bool operator==(const Element& other) const { return value == other.value; }
+};
+
+static_assert(type_traits::is_trivially_copyable<uint8_t>::value &&
+              !type_traits::is_trivially_copyable<Element<uint8_t>>::value,
+              "The baseline must take the element-wise copy path!");
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void fill(T (&values)[Size])
+{
+    for (size_t i{}; i < Size; ++i) { values[i] = T{static_cast<uint8_t>(i * 37U)}; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bench::Measurement copyArray(bool& correct)
+{
+    static container::Array<T, NumBytes> source{};
+    static container::Array<T, NumBytes> destination{};
+    for (size_t i{}; i < NumBytes; ++i) { source[i] = T{static_cast<uint8_t>(i * 37U)}; }
+    const auto measured{bench::measure([]
+    {
+        destination = source;
+        bench::keep(destination);
+    }, 1U)};
+    correct = true;
+    for (size_t i{}; i < NumBytes; ++i) { correct = correct && destination[i] == source[i]; }
+    return measured;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bench::Measurement copyVector(bool& correct)
+{
+    static container::Vector<T> source(NumBytes);
+    for (size_t i{}; i < NumBytes; ++i) { source[i] = T{static_cast<uint8_t>(i * 37U)}; }
+    const auto measured{bench::measure([]
+    {
+        container::Vector<T> destination{source};
+        bench::keep(destination);
+    }, 1U)};
+    container::Vector<T> destination{source};
+    correct = destination.size() == NumBytes;
+    for (size_t i{}; correct && i < NumBytes; ++i) { correct = destination[i] == source[i]; }
+    return measured;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bench::Measurement appendVector(bool& correct)
+{
+    constexpr size_t NumValues{NumBytes / sizeof(T)};
+    static T values[NumValues]{};
+    static container::Vector<T> destination{};
+    fill(values);
+    destination.reserve(NumValues);
+    const auto measured{bench::measure([]
+    {
+        destination += values;
+        bench::keep(destination);
+        destination.clear();
+        destination.reserve(NumValues);
+    }, 1U)};
+    destination += values;
+    correct = destination.size() == NumValues;
+    for (size_t i{}; correct && i < NumValues; ++i) { correct = destination[i] == values[i]; }
+    destination.clear();
+    return measured;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bench::Measurement appendStaticVector(bool& correct)
+{
+    static T values[NumBytes]{};
+    static container::StaticVector<T, NumBytes> destination{};
+    fill(values);
+    const auto measured{bench::measure([]
+    {
+        destination += values;
+        bench::keep(destination);
+        destination.clear();
+    }, 1U)};
+    destination += values;
+    correct = destination.size() == NumBytes;
+    for (size_t i{}; correct && i < NumBytes; ++i) { correct = destination[i] == values[i]; }
+    destination.clear();
+    return measured;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Workload>
+void benchmark(const char* name, Workload&& blockCopy, Workload&& elementCopy)
+{
+    bool blockCorrect{}, elementCorrect{};
+    const auto block{blockCopy(blockCorrect)};
+    const auto element{elementCopy(elementCorrect)};
+    bench::print(name, block, element);
+    gate.check(name, blockCorrect && elementCorrect);
+    gate.checkRatio(name, block, element, 1.0);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    bench::printHeader("Block copies of 256 bytes against element-wise copies (baseline)");
+    benchmark("Array<uint8_t, 256> assignment", copyArray<uint8_t>, copyArray<Element<uint8_t>>);
+    benchmark("Vector<uint8_t> copy (256)", copyVector<uint8_t>, copyVector<Element<uint8_t>>);
+    benchmark("Vector<uint16_t> += raw[128]", appendVector<uint16_t>,
+              appendVector<Element<uint16_t>>);
+    benchmark("StaticVector<uint8_t, 256> += raw[256]", appendStaticVector<uint8_t>,
+              appendStaticVector<Element<uint8_t>>);
+    return gate.result();
+}
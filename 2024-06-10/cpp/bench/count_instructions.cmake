@@ -0,0 +1,59 @@
+# Counts the instructions of the functions in register_ops.cpp and checks that
+# every folded_<name> function is shorter than its per_bit_<name> counterpart.
+#
+#     cmake -DOBJDUMP=<objdump> -DFILE=<object or executable> -P count_instructions.cmake
+#
+# Works with the host objdump as well as with avr-objdump.
+execute_process(COMMAND ${OBJDUMP} -d -w ${FILE}
+                OUTPUT_VARIABLE listing
+                RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed on ${FILE}")
+endif()
+
+# Escape the characters that have a meaning in CMake lists before splitting
+# the listing into lines.
+string(REPLACE ";" "," listing "${listing}")
+string(REPLACE "[" "(" listing "${listing}")
+string(REPLACE "]" ")" listing "${listing}")
+string(REPLACE "\n" ";" lines "${listing}")
+
+set(functions)
+unset(function)
+foreach(line IN LISTS lines)
+    if(line MATCHES "^[0-9a-f]+ <((per_bit|folded)_[a-z_]+)>:$")
+        set(function ${CMAKE_MATCH_1})
+        set(count_${function} 0)
+        list(APPEND functions ${function})
+    elseif(DEFINED function AND line MATCHES "^ *[0-9a-f]+:\t")
+        math(EXPR count_${function} "${count_${function}} + 1")
+    elseif(line STREQUAL "")
+        unset(function)
+    endif()
+endforeach()
+
+set(failures 0)
+foreach(function IN LISTS functions)
+    if(NOT function MATCHES "^per_bit_(.+)$")
+        continue()
+    endif()
+    set(folded folded_${CMAKE_MATCH_1})
+    if(NOT DEFINED count_${folded})
+        message(SEND_ERROR "${folded} not found in ${FILE}")
+        math(EXPR failures "${failures} + 1")
+        continue()
+    endif()
+    if(count_${folded} LESS count_${function})
+        set(verdict "ok")
+    else()
+        set(verdict "FAILED")
+        math(EXPR failures "${failures} + 1")
+    endif()
+    message("${CMAKE_MATCH_1}: ${count_${function}} -> ${count_${folded}} instructions ${verdict}")
+endforeach()
+
+if(NOT functions)
+    message(FATAL_ERROR "No per_bit_ functions found in ${FILE}")
+elseif(failures GREATER 0)
+    message(FATAL_ERROR "${failures} folded functions aren't shorter than their per-bit versions")
+endif()
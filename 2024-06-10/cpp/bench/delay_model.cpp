@@ -0,0 +1,197 @@
+/********************************************************************************
+ * @brief Cycle model of utils::delayCycles, reporting the delay error of
+ *        utils::delayUs and utils::delayMs for delay times that aren't
+ *        compile-time constants.
+ *
+ * @note The assembly sequence of delayCycles in utils.cpp is executed by a
+ *       small simulator of the instructions it uses, with the cycle counts of
+ *       the ATmega328P from the AVR instruction set manual. The cycles are
+ *       counted by stepping through the instructions rather than by the
+ *       formula in utils.h, so the model checks the formula and the overhead.
+ *       The gate checks that every delay of at least 31 cycles is at most
+ *       seven cycles short and never too long, and that shorter delays take
+ *       14 cycles. The simulated program must be kept in sync with utils.cpp.
+ ********************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+
+#include <initializer_list>
+
+#include "bench.h"
+
+namespace
+{
+
+constexpr uint32_t CpuFrequency{16000000UL};
+constexpr uint32_t CyclesPerUs{CpuFrequency / 1000000UL};
+constexpr uint32_t CyclesPerMs{CpuFrequency / 1000UL};
+
+// Cycles of the CALL to delayCycles on the ATmega328P, whose program counter
+// is 16 bits wide.
+constexpr uint32_t CallCycles{4U};
+
+bench::Gate gate{};
+
+/********************************************************************************
+ * @brief Instructions used by delayCycles.
+ ********************************************************************************/
+enum class Opcode { Subi, Sbci, Lsr, Ror, Brcs, Nop, Rjmp, Ret };
+
+/********************************************************************************
+ * @brief Instruction with its register (r22 - r25 map onto 0 - 3) and its
+ *        immediate operand or jump target.
+ ********************************************************************************/
+struct Instruction
+{
+    Opcode opcode;
+    uint8_t reg;
+    uint8_t operand;
+};
+
+// Labels of the program below.
+constexpr uint8_t Loop{17U};
+constexpr uint8_t Done{24U};
+
+// The assembly sequence of delayCycles in utils.cpp.
+constexpr Instruction program[]
+{
+    {Opcode::Subi, 0U, 31U}, {Opcode::Sbci, 1U, 0U}, {Opcode::Sbci, 2U, 0U},
+    {Opcode::Sbci, 3U, 0U}, {Opcode::Brcs, 0U, Done},
+
+    {Opcode::Lsr, 3U, 0U}, {Opcode::Ror, 2U, 0U}, {Opcode::Ror, 1U, 0U}, {Opcode::Ror, 0U, 0U},
+    {Opcode::Lsr, 3U, 0U}, {Opcode::Ror, 2U, 0U}, {Opcode::Ror, 1U, 0U}, {Opcode::Ror, 0U, 0U},
+    {Opcode::Lsr, 3U, 0U}, {Opcode::Ror, 2U, 0U}, {Opcode::Ror, 1U, 0U}, {Opcode::Ror, 0U, 0U},
+
+    {Opcode::Subi, 0U, 1U}, {Opcode::Sbci, 1U, 0U}, {Opcode::Sbci, 2U, 0U},
+    {Opcode::Sbci, 3U, 0U}, {Opcode::Brcs, 0U, Done}, {Opcode::Nop, 0U, 0U},
+    {Opcode::Rjmp, 0U, Loop},
+
+    {Opcode::Ret, 0U, 0U},
+};
+
+static_assert(program[Loop].opcode == Opcode::Subi && program[Done].opcode == Opcode::Ret,
+              "The labels must point at the loop and the return!");
+
+// -----------------------------------------------------------------------------
+uint32_t simulateDelay(const uint32_t cycles)
+{
+    uint8_t reg[4]{static_cast<uint8_t>(cycles), static_cast<uint8_t>(cycles >> 8U),
+                   static_cast<uint8_t>(cycles >> 16U), static_cast<uint8_t>(cycles >> 24U)};
+    bool carry{};
+    uint32_t elapsed{CallCycles};
+
+    for (uint8_t pc{};;)
+    {
+        const auto& instruction{program[pc++]};
+        auto& value{reg[instruction.reg]};
+        switch (instruction.opcode)
+        {
+            case Opcode::Subi:
+                carry = instruction.operand > value;
+                value = static_cast<uint8_t>(value - instruction.operand);
+                elapsed += 1U;
+                break;
+            case Opcode::Sbci:
+            {
+                const uint16_t subtrahend{static_cast<uint16_t>(instruction.operand + carry)};
+                carry = subtrahend > value;
+                value = static_cast<uint8_t>(value - subtrahend);
+                elapsed += 1U;
+                break;
+            }
+            case Opcode::Lsr:
+                carry = value & 1U;
+                value = static_cast<uint8_t>(value >> 1U);
+                elapsed += 1U;
+                break;
+            case Opcode::Ror:
+            {
+                const bool shiftedOut{static_cast<bool>(value & 1U)};
+                value = static_cast<uint8_t>((carry ? 0x80U : 0U) | (value >> 1U));
+                carry = shiftedOut;
+                elapsed += 1U;
+                break;
+            }
+            case Opcode::Brcs:
+                if (carry) { pc = instruction.operand; }
+                elapsed += carry ? 2U : 1U;
+                break;
+            case Opcode::Nop:
+                elapsed += 1U;
+                break;
+            case Opcode::Rjmp:
+                pc = instruction.operand;
+                elapsed += 2U;
+                break;
+            case Opcode::Ret:
+                return elapsed + 4U;
+        }
+    }
+}
+
+/********************************************************************************
+ * @brief Delay error found over a range of delay times.
+ ********************************************************************************/
+struct Error
+{
+    int32_t min{INT32_MAX};
+    int32_t max{INT32_MIN};
+    bool inBounds{true};
+};
+
+// -----------------------------------------------------------------------------
+void addDelay(Error& error, const uint32_t cycles)
+{
+    const auto elapsed{simulateDelay(cycles)};
+    const auto difference{static_cast<int32_t>(elapsed - cycles)};
+    if (difference < error.min) { error.min = difference; }
+    if (difference > error.max) { error.max = difference; }
+    error.inBounds = error.inBounds &&
+        (cycles >= 31U ? difference <= 0 && difference > -8 : elapsed == 14U);
+}
+
+// -----------------------------------------------------------------------------
+void report(const char* name, const Error& error)
+{
+    printf("%-40s %6ld .. %3ld cycles (%.3f .. %.3f us)\n", name,
+           static_cast<long>(error.min), static_cast<long>(error.max),
+           error.min / static_cast<double>(CyclesPerUs), error.max / static_cast<double>(CyclesPerUs));
+    gate.check(name, error.inBounds);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    printf("Delay error of delayCycles on the ATmega328P (elapsed - requested)\n");
+
+    Error cycles{};
+    for (uint32_t i{}; i < 65536UL; ++i) { addDelay(cycles, i); }
+    report("delayCycles(0 - 65535)", cycles);
+
+    // Every delay time up to 2000 us, then every 97th up to the maximum.
+    Error us{};
+    for (uint32_t time{1U}; time <= UINT16_MAX; time += time < 2000U ? 1U : 97U)
+    {
+        addDelay(us, time * CyclesPerUs);
+    }
+    addDelay(us, UINT16_MAX * CyclesPerUs);
+    report("delayUs(1 - 2000, sampled to 65535)", us);
+
+    // The loop takes 2000 iterations per millisecond, so only a sample of the
+    // delay times is simulated, including the maximum.
+    Error ms{};
+    for (uint32_t time{1U}; time <= 16U; ++time) { addDelay(ms, time * CyclesPerMs); }
+    for (const uint32_t time : {100UL, 1000UL, 10000UL, 65535UL})
+    {
+        addDelay(ms, time * CyclesPerMs);
+    }
+    report("delayMs(1 - 16, sampled to 65535)", ms);
+
+    // delayS calls delayCycles once per second.
+    Error s{};
+    addDelay(s, CpuFrequency);
+    report("delayS, per second", s);
+    return gate.result();
+}
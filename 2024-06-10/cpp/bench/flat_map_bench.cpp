@@ -0,0 +1,209 @@
+/********************************************************************************
+ * @brief Checks and benchmarks of container::FlatMap against a linear search
+ *        over a container::Vector of container::Pair.
+ *
+ * @note The linear search is what lookup tables were built with before
+ *       FlatMap existed. Integer keys stand for pin -> handler tables and
+ *       string keys for command names. The maps are filled to three quarters
+ *       of their capacity. The gate checks the map against std::map for a
+ *       random sequence of inserts and removals, that the map never allocates
+ *       and that lookups are at least as fast as the linear search from 48
+ *       entries. Inserts are compared with a linear search for the key
+ *       followed by pushBack.
+ ********************************************************************************/
+#include <stdio.h>
+
+#include <map>
+#include <string>
+
+#include "../flat_map.h"
+#include "../pair.h"
+#include "../vector.h"
+#include "bench.h"
+
+namespace
+{
+
+constexpr size_t NumLookups{1024};
+
+bench::Gate gate{};
+char names[256][12]{};
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V>
+const V* linearFind(const container::Vector<container::Pair<K, V>>& table, const K& key)
+{
+    for (const auto& entry : table)
+    {
+        if (container::Hash<K>::equal(entry.first, key)) { return &entry.second; }
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t nextRandom(uint32_t& seed)
+{
+    seed = seed * 1664525U + 1013904223U;
+    return seed >> 16U;
+}
+
+// -----------------------------------------------------------------------------
+void checkResults()
+{
+    container::FlatMap<uint16_t, uint32_t, 64> map{};
+    std::map<uint16_t, uint32_t> reference{};
+    uint32_t seed{3U};
+    bool matches{true};
+
+    // Few distinct keys, so that removals hit long probe runs and have to
+    // shift entries backwards.
+    for (uint32_t i{}; i < 100000U; ++i)
+    {
+        const auto key{static_cast<uint16_t>(nextRandom(seed) % 96U * 64U)};
+        if (nextRandom(seed) % 3U == 0U)
+        {
+            matches = matches && map.remove(key) == (reference.erase(key) > 0);
+        }
+        else if (reference.size() < 48 || reference.count(key) > 0)
+        {
+            matches = matches && map.insert(key, i);
+            reference[key] = i;
+        }
+        matches = matches && map.size() == reference.size();
+    }
+    for (uint16_t key{}; key < 96U * 64U; key += 64U)
+    {
+        const auto value{map.find(key)};
+        const auto expected{reference.find(key)};
+        matches = matches && (expected == reference.end() ? value == nullptr :
+                              value != nullptr && *value == expected->second);
+    }
+    gate.check("FlatMap matches std::map after 100000 inserts and removals", matches);
+
+    container::FlatMap<uint8_t, uint8_t, 8> full{};
+    for (uint8_t key{}; key < 8U; ++key) { full.insert(key, key); }
+    gate.check("FlatMap refuses new keys when full but updates present keys",
+               full.full() && !full.insert(8U, 8U) && full.insert(3U, 30U) &&
+               *full.find(3U) == 30U);
+
+    container::FlatMap<const char*, uint8_t, 16> commands{};
+    std::string key{"led"};
+    commands.insert("led", 1U);
+    commands.insert("button", 2U);
+    gate.check("FlatMap<const char*> compares keys by content",
+               commands.find(key.c_str()) != nullptr && *commands.find(key.c_str()) == 1U &&
+               !commands.contains("serial"));
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Capacity>
+void benchmarkIntegers()
+{
+    constexpr size_t NumEntries{Capacity * 3 / 4};
+    static container::FlatMap<uint16_t, uint16_t, Capacity> map{};
+    static container::Vector<container::Pair<uint16_t, uint16_t>> table{};
+    static uint16_t keys[NumLookups]{};
+
+    const auto fill{bench::measure([]
+    {
+        map.clear();
+        for (uint16_t i{}; i < NumEntries; ++i) { map.insert(i * 7U, i); }
+        bench::keep(map);
+    }, NumEntries)};
+    const auto linearFill{bench::measure([]
+    {
+        table.clear();
+        for (uint16_t i{}; i < NumEntries; ++i)
+        {
+            const auto key{static_cast<uint16_t>(i * 7U)};
+            if (linearFind(table, key) == nullptr) { table.pushBack({key, i}); }
+        }
+        bench::keep(table);
+    }, NumEntries)};
+
+    uint32_t seed{Capacity};
+    for (auto& key : keys) { key = static_cast<uint16_t>(nextRandom(seed) % NumEntries * 7U); }
+
+    const auto find{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto key : keys) { sum += *map.find(key); }
+        bench::keep(sum);
+    }, NumLookups)};
+    const auto linear{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto key : keys) { sum += *linearFind(table, key); }
+        bench::keep(sum);
+    }, NumLookups)};
+
+    char name[64]{};
+    snprintf(name, sizeof(name), "insert %zu uint16_t keys", NumEntries);
+    bench::print(name, fill, linearFill);
+    gate.checkAllocations(name, fill, 0U);
+    snprintf(name, sizeof(name), "find in %zu uint16_t keys", NumEntries);
+    bench::print(name, find, linear);
+    gate.checkAllocations(name, find, 0U);
+    if (NumEntries >= 48) { gate.checkRatio(name, find, linear, 1.0); }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Capacity>
+void benchmarkStrings()
+{
+    constexpr size_t NumEntries{Capacity * 3 / 4};
+    static container::FlatMap<const char*, uint16_t, Capacity> map{};
+    static container::Vector<container::Pair<const char*, uint16_t>> table{};
+    static const char* keys[NumLookups]{};
+
+    map.clear();
+    table.clear();
+    for (uint16_t i{}; i < NumEntries; ++i)
+    {
+        map.insert(names[i], i);
+        table.pushBack({names[i], i});
+    }
+
+    // Look up copies of the names, so that neither side can compare pointers.
+    static char copies[256][12]{};
+    for (size_t i{}; i < NumEntries; ++i) { snprintf(copies[i], sizeof(copies[i]), "%s", names[i]); }
+    uint32_t seed{Capacity};
+    for (auto& key : keys) { key = copies[nextRandom(seed) % NumEntries]; }
+
+    const auto find{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto key : keys) { sum += *map.find(key); }
+        bench::keep(sum);
+    }, NumLookups)};
+    const auto linear{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto key : keys) { sum += *linearFind(table, key); }
+        bench::keep(sum);
+    }, NumLookups)};
+
+    char name[64]{};
+    snprintf(name, sizeof(name), "find in %zu command names", NumEntries);
+    bench::print(name, find, linear);
+    gate.checkAllocations(name, find, 0U);
+    if (NumEntries >= 48) { gate.checkRatio(name, find, linear, 1.0); }
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    for (size_t i{}; i < 256; ++i) { snprintf(names[i], sizeof(names[i]), "command%zu", i); }
+
+    checkResults();
+    bench::printHeader("FlatMap against linear search in Vector<Pair> (baseline)");
+    benchmarkIntegers<16>();
+    benchmarkIntegers<64>();
+    benchmarkIntegers<256>();
+    benchmarkStrings<16>();
+    benchmarkStrings<64>();
+    benchmarkStrings<256>();
+    return gate.result();
+}
@@ -0,0 +1,78 @@
+/********************************************************************************
+ * @brief Benchmark of the node allocation policies of container::List.
+ *
+ * @note Each round pushes 32 values, inserts and removes a value in the middle
+ *       of the list and pops all values. The heap policy, which allocates
+ *       every node via malloc, is the baseline. The gate checks that the
+ *       fixed pool never touches the heap, that the growable pool only
+ *       allocates slabs when it runs out of nodes and that both pools are at
+ *       least as fast as the heap.
+ ********************************************************************************/
+#include <stdio.h>
+
+#include "../list.h"
+#include "bench.h"
+
+namespace
+{
+
+constexpr size_t NumValues{32};
+constexpr size_t NumRounds{64};
+constexpr size_t SlabSize{8};
+
+// Each value is pushed, popped and one value is inserted and removed.
+constexpr size_t OpsPerRun{NumRounds * (2 * NumValues + 2)};
+
+bench::Gate gate{};
+
+// -----------------------------------------------------------------------------
+template <typename Allocation>
+void runRounds()
+{
+    container::List<uint32_t, Allocation> list{};
+    for (size_t round{}; round < NumRounds; ++round)
+    {
+        for (size_t i{}; i < NumValues; ++i) { list.pushBack(static_cast<uint32_t>(i)); }
+        auto last{list.rbegin()};
+        list.insert(last, 0U);
+        auto middle{list.begin()};
+        middle += NumValues / 2;
+        list.remove(middle);
+        for (size_t i{}; i < NumValues; ++i) { list.popBack(); }
+    }
+    bench::keep(list);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    using Heap = container::allocation::Heap;
+    using Pool = container::allocation::Pool<NumValues + 1>;
+    using Slabs = container::allocation::Pool<SlabSize, true>;
+
+    bench::printHeader("List node pools against the heap (baseline), insert/remove");
+    const auto heap{bench::measure(runRounds<Heap>, OpsPerRun)};
+    const auto pool{bench::measure(runRounds<Pool>, OpsPerRun)};
+    const auto slabs{bench::measure(runRounds<Slabs>, OpsPerRun)};
+
+    bench::print("Heap", heap, heap);
+    bench::print("Pool<33>", pool, heap);
+    bench::print("Pool<8, true> (slabs)", slabs, heap);
+
+    gate.checkAllocations("Heap", heap, NumRounds * (NumValues + 1));
+    gate.checkAllocations("Pool<33>", pool, 0U);
+
+    // The 33 nodes take the 8 nodes of the pool and four slabs. The slabs are
+    // kept by the allocator, which is shared by all lists of the same type, so
+    // only the first run allocates any.
+    gate.checkAllocations("Pool<8, true> (slabs)", slabs,
+                          (NumValues + 1 - SlabSize + SlabSize - 1) / SlabSize);
+    const auto slabsAgain{bench::measure(runRounds<Slabs>, OpsPerRun)};
+    gate.checkAllocations("Pool<8, true> (slabs) after warm-up", slabsAgain, 0U);
+
+    gate.checkRatio("Pool<33>", pool, heap, 1.0);
+    gate.checkRatio("Pool<8, true> (slabs)", slabs, heap, 1.0);
+    return gate.result();
+}
@@ -0,0 +1,226 @@
+/********************************************************************************
+ * @brief Checks and benchmarks of the integer math in utils.h: power by
+ *        squaring, isqrt, ilog2 and muldiv.
+ *
+ * @note The results are compared against reference implementations over the
+ *       full 16-bit range and a sweep of the 32-bit range. The timings are
+ *       compared against the straightforward implementations, such as the
+ *       previous power loop with one multiplication per exponent step. The
+ *       host has a hardware square root for doubles, unlike the ATmega328P,
+ *       where sqrt is emulated in software, so isqrt is reported but not
+ *       gated against it.
+ ********************************************************************************/
+#include <math.h>
+#include <stdio.h>
+
+#include <limits>
+
+#include "../utils.h"
+#include "bench.h"
+
+namespace
+{
+
+// The functions are constexpr and are hence also checked at compile time.
+static_assert(utils::power(3, 4U) == 81 && utils::power(2UL, 31U) == 0x80000000UL &&
+              utils::power(7, 0U) == 1, "Calculation of power by squaring is broken!");
+static_assert(utils::isqrt(0U) == 0U && utils::isqrt(15U) == 3U && utils::isqrt(16U) == 4U &&
+              utils::isqrt(UINT32_MAX) == 65535U, "Calculation of square root is broken!");
+static_assert(utils::ilog2(1U) == 0U && utils::ilog2(1024U) == 10U &&
+              utils::ilog2(UINT32_MAX) == 31U, "Calculation of logarithm is broken!");
+static_assert(utils::muldiv(UINT32_MAX, UINT32_MAX, UINT32_MAX) == UINT32_MAX &&
+              utils::muldiv(1U, 1U, 0U) == UINT64_MAX,
+              "Calculation of multiply-divide is broken!");
+
+constexpr size_t NumInputs{4096};
+
+bench::Gate gate{};
+uint32_t inputs[NumInputs]{};
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool referencePower(const T base, const uint8_t exponent, T& result)
+{
+    __int128 power{1};
+    for (uint8_t i{}; i < exponent; ++i)
+    {
+        power *= base;
+        if (power < std::numeric_limits<T>::min() || power > std::numeric_limits<T>::max())
+        {
+            return false;
+        }
+    }
+    result = static_cast<T>(power);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void checkPower(const char* name)
+{
+    bool ok{true};
+    for (int base{-40}; base <= 40; ++base)
+    {
+        for (uint16_t exponent{}; exponent <= 40U; ++exponent)
+        {
+            T expected{}, result{};
+            const auto fits{referencePower(static_cast<T>(base), static_cast<uint8_t>(exponent), expected)};
+            if (utils::power(static_cast<T>(base), static_cast<uint8_t>(exponent), result) != fits ||
+                (fits && result != expected))
+            {
+                ok = false;
+            }
+        }
+    }
+    gate.check(name, ok);
+}
+
+// -----------------------------------------------------------------------------
+void checkResults()
+{
+    checkPower<int8_t>("power with overflow detection matches reference (int8_t)");
+    checkPower<int16_t>("power with overflow detection matches reference (int16_t)");
+    checkPower<int32_t>("power with overflow detection matches reference (int32_t)");
+    checkPower<uint16_t>("power with overflow detection matches reference (uint16_t)");
+
+    bool ok{true};
+    for (uint32_t value{}; value <= UINT16_MAX; ++value)
+    {
+        const auto root{utils::isqrt(static_cast<uint16_t>(value))};
+        if (static_cast<uint32_t>(root) * root > value ||
+            (static_cast<uint32_t>(root) + 1U) * (root + 1U) <= value) { ok = false; }
+    }
+    for (uint64_t root{1}; root <= UINT16_MAX; ++root)
+    {
+        const auto square{static_cast<uint32_t>(root * root)};
+        if (utils::isqrt(square) != root || utils::isqrt(square - 1U) != root - 1U) { ok = false; }
+    }
+    ok = ok && utils::isqrt(UINT32_MAX) == UINT16_MAX;
+    gate.check("isqrt matches reference over the 16-bit range and all 32-bit squares", ok);
+
+    ok = true;
+    for (uint32_t value{1}; value <= UINT16_MAX; ++value)
+    {
+        if (utils::ilog2(static_cast<uint16_t>(value)) != 31 - __builtin_clz(value)) { ok = false; }
+    }
+    for (uint8_t bit{}; bit < 32U; ++bit)
+    {
+        const auto value{1UL << bit};
+        if (utils::ilog2(static_cast<uint32_t>(value)) != bit ||
+            utils::ilog2(static_cast<uint32_t>(value | (value - 1U))) != bit) { ok = false; }
+    }
+    gate.check("ilog2 matches reference over the 16-bit range and all 32-bit bits", ok);
+
+    ok = true;
+    uint32_t seed{12345U};
+    for (uint32_t i{}; i < 1000000U; ++i)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        const uint32_t a{seed};
+        seed = seed * 1664525U + 1013904223U;
+        const uint32_t b{i % 2U ? seed : seed >> 16U};
+        seed = seed * 1664525U + 1013904223U;
+        const uint32_t divisor{(seed >> (seed % 32U)) | 1U};
+        const auto expected{static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) / divisor)};
+        if (utils::muldiv(a, b, divisor) != expected) { ok = false; }
+    }
+    gate.check("muldiv matches 128-bit reference for 1M pseudo-random operands", ok);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T loopPower(const T base, const uint8_t exponent)
+{
+    T result{1};
+    for (uint8_t i{}; i < exponent; ++i) { result *= base; }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t loopLog2(uint32_t value)
+{
+    uint8_t result{};
+    while (value >>= 1U) { result++; }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+void benchmark()
+{
+    uint32_t seed{1U};
+    for (auto& input : inputs)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        input = seed;
+    }
+
+    bench::printHeader("Integer math against straightforward versions (baseline)");
+
+    const auto power{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto input : inputs) { sum += utils::power<uint32_t, uint8_t>(input, input % 32U); }
+        bench::keep(sum);
+    }, NumInputs)};
+    const auto loop{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto input : inputs) { sum += loopPower<uint32_t>(input, input % 32U); }
+        bench::keep(sum);
+    }, NumInputs)};
+    bench::print("power (exponent 0 - 31)", power, loop);
+    gate.checkRatio("power", power, loop, 1.5);
+
+    const auto isqrt{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto input : inputs) { sum += utils::isqrt(input); }
+        bench::keep(sum);
+    }, NumInputs)};
+    const auto sqrt{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto input : inputs) { sum += static_cast<uint32_t>(::sqrt(static_cast<double>(input))); }
+        bench::keep(sum);
+    }, NumInputs)};
+    bench::print("isqrt (vs double sqrt)", isqrt, sqrt);
+
+    const auto ilog2{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto input : inputs) { sum += utils::ilog2(input); }
+        bench::keep(sum);
+    }, NumInputs)};
+    const auto shiftLoop{bench::measure([]
+    {
+        uint32_t sum{};
+        for (const auto input : inputs) { sum += loopLog2(input); }
+        bench::keep(sum);
+    }, NumInputs)};
+    bench::print("ilog2 (vs shift loop)", ilog2, shiftLoop);
+    gate.checkRatio("ilog2", ilog2, shiftLoop, 1.5);
+
+    const auto muldiv{bench::measure([]
+    {
+        uint64_t sum{};
+        for (const auto input : inputs) { sum += utils::muldiv(input, input >> 20U, 1000U); }
+        bench::keep(sum);
+    }, NumInputs)};
+    const auto wide{bench::measure([]
+    {
+        uint64_t sum{};
+        for (const auto input : inputs) { sum += static_cast<uint64_t>(input) * (input >> 20U) / 1000U; }
+        bench::keep(sum);
+    }, NumInputs)};
+    bench::print("muldiv (vs 64-bit division)", muldiv, wide);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    checkResults();
+    benchmark();
+    return gate.result();
+}
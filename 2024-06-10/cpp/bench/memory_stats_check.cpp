@@ -0,0 +1,90 @@
+/********************************************************************************
+ * @brief Checks of the call sites recorded by the memory statistics, built
+ *        with UTILS_MEMORY_STATS defined.
+ *
+ * @note Allocations made by the containers must be recorded at the line where
+ *       the container calls its allocator and direct calls of newMemory at
+ *       the line of the call, both without the directory of the file. No
+ *       allocation may be recorded in the allocation policies or in utils.h,
+ *       which all allocations pass through.
+ ********************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "../list.h"
+#include "../memory_stats.h"
+#include "../vector.h"
+#include "bench.h"
+
+namespace
+{
+
+bench::Gate gate{};
+
+// -----------------------------------------------------------------------------
+const utils::memory_stats::CallSite* findCallSite(const utils::memory_stats::Snapshot& snapshot,
+                                                  const char* file)
+{
+    for (uint8_t i{}; i < snapshot.numCallSites; ++i)
+    {
+        if (strcmp(snapshot.callSites[i].file, file) == 0) { return &snapshot.callSites[i]; }
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+void printCallSites()
+{
+    const auto snapshot{utils::memory_stats::snapshot()};
+    for (uint8_t i{}; i < snapshot.numCallSites; ++i)
+    {
+        const auto& site{snapshot.callSites[i]};
+        printf("%s:%u: %u allocations, %u reallocations, %zu bytes at peak\n", site.file,
+               site.line, site.allocations, site.reallocations, site.peakBytes);
+    }
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    {
+        container::Vector<uint16_t> vector{};
+        for (uint16_t i{}; i < 100U; ++i) { vector.pushBack(i); }
+        container::List<uint32_t> list{};
+        for (uint32_t i{}; i < 10U; ++i) { list.pushBack(i); }
+        container::List<uint32_t, container::allocation::Pool<4, true>> pooled{};
+        for (uint32_t i{}; i < 10U; ++i) { pooled.pushBack(i); }
+    }
+    auto block{utils::newMemory<uint8_t>(16)};
+    const uint16_t line{__LINE__ - 1};
+    printCallSites();
+    const auto snapshot{utils::memory_stats::snapshot()};
+
+    const auto vectorSite{findCallSite(snapshot, "vector_impl.h")};
+    gate.check("Vector growth is recorded in vector_impl.h",
+               vectorSite != nullptr && vectorSite->reallocations > 0 &&
+               vectorSite->liveBytes == 0U);
+
+    // Ten nodes of the heap list and two slabs of the pooled list, whose first
+    // four nodes are taken from the pool itself.
+    const auto listSite{findCallSite(snapshot, "list_impl.h")};
+    gate.check("List nodes and pool slabs are recorded in list_impl.h",
+               listSite != nullptr && listSite->allocations == 10U + 2U);
+
+    const auto directSite{findCallSite(snapshot, "memory_stats_check.cpp")};
+    gate.check("newMemory is recorded at the line of the call",
+               directSite != nullptr && directSite->line == line && directSite->liveBytes == 16U);
+
+    gate.check("No allocation is recorded in allocation_impl.h or utils_impl.h",
+               findCallSite(snapshot, "allocation_impl.h") == nullptr &&
+               findCallSite(snapshot, "utils_impl.h") == nullptr);
+
+    // The slabs are kept by the pool allocator, which is shared by all lists of
+    // the same type, so only they remain.
+    gate.check("All bytes except the pool slabs are released",
+               listSite != nullptr && snapshot.liveBytes == listSite->liveBytes + 16U);
+    utils::deleteMemory(block);
+    return gate.result();
+}
@@ -0,0 +1,83 @@
+/********************************************************************************
+ * @brief Checks and benchmarks of the register updates in register_ops.cpp.
+ *
+ * @note The registers are the bytes of the <avr/io.h> shim. The gate checks
+ *       that each folded update leaves the registers in the same state as its
+ *       per-bit version and that it is at least as fast. The instruction
+ *       counts are checked separately by count_instructions.cmake.
+ ********************************************************************************/
+#include <stdio.h>
+
+#include <avr/io.h>
+
+#include "bench.h"
+
+extern "C" void per_bit_set_adcsra();
+extern "C" void folded_set_adcsra();
+extern "C" void per_bit_clear_portb();
+extern "C" void folded_clear_portb();
+extern "C" void per_bit_toggle_portb();
+extern "C" void folded_toggle_portb();
+extern "C" void per_bit_write_adcsra(uint8_t prescaler);
+extern "C" void folded_write_adcsra(uint8_t prescaler);
+
+namespace
+{
+
+constexpr size_t NumUpdates{1024};
+
+bench::Gate gate{};
+
+// -----------------------------------------------------------------------------
+template <typename PerBit, typename Folded>
+bool sameResult(volatile uint8_t& reg, PerBit&& perBit, Folded&& folded)
+{
+    for (uint16_t initial{}; initial <= UINT8_MAX; ++initial)
+    {
+        reg = static_cast<uint8_t>(initial);
+        perBit();
+        const uint8_t expected{reg};
+        reg = static_cast<uint8_t>(initial);
+        folded();
+        if (reg != expected) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename PerBit, typename Folded>
+void benchmark(const char* name, volatile uint8_t& reg, PerBit&& perBit, Folded&& folded)
+{
+    gate.check(name, sameResult(reg, perBit, folded));
+    const auto perBitTime{bench::measure([&]
+    {
+        for (size_t i{}; i < NumUpdates; ++i) { perBit(); }
+    }, NumUpdates)};
+    const auto foldedTime{bench::measure([&]
+    {
+        for (size_t i{}; i < NumUpdates; ++i) { folded(); }
+    }, NumUpdates)};
+    bench::print(name, foldedTime, perBitTime);
+    gate.checkRatio(name, foldedTime, perBitTime, 1.0);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    bench::printHeader("Folded register updates against one update per bit (baseline)");
+    benchmark("set(ADCSRA, 5 bits)", ADCSRA, per_bit_set_adcsra, folded_set_adcsra);
+    benchmark("clear(PORTB, 3 bits)", PORTB, per_bit_clear_portb, folded_clear_portb);
+    benchmark("toggle(PORTB, 2 bits)", PORTB, per_bit_toggle_portb, folded_toggle_portb);
+
+    const uint8_t prescalers[]{2U, 7U};
+    for (const auto prescaler : prescalers)
+    {
+        char name[64]{};
+        snprintf(name, sizeof(name), "write(ADCSRA, ADPS, %u)", prescaler);
+        benchmark(name, ADCSRA, [prescaler] { per_bit_write_adcsra(prescaler); },
+                  [prescaler] { folded_write_adcsra(prescaler); });
+    }
+    return gate.result();
+}
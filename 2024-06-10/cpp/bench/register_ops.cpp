@@ -0,0 +1,81 @@
+/********************************************************************************
+ * @brief Register updates via utils::set, clear, toggle and write next to the
+ *        per-bit versions they replace, for instruction counting.
+ *
+ * @note Every per_bit_<name> function has a folded_<name> counterpart doing
+ *       the same update. The per-bit versions issue one volatile
+ *       read-modify-write per bit, like the recursive utils::set did before,
+ *       while the folded versions use the helpers of utils.h. The file is
+ *       compiled for the host into register_bench and, when avr-g++ is found,
+ *       for the ATmega328P. count_instructions.cmake then disassembles the
+ *       result and checks that every folded function takes fewer instructions
+ *       than its per-bit counterpart.
+ ********************************************************************************/
+#include <avr/io.h>
+
+#include "../utils.h"
+
+namespace
+{
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void perBitSet(volatile T& reg, const uint8_t bit) { reg |= static_cast<T>(1U << bit); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Bits>
+void perBitSet(volatile T& reg, const uint8_t bit, const Bits... bits)
+{
+    perBitSet(reg, bit);
+    perBitSet(reg, bits...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void perBitClear(volatile T& reg, const uint8_t bit) { reg &= static_cast<T>(~(1U << bit)); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Bits>
+void perBitClear(volatile T& reg, const uint8_t bit, const Bits... bits)
+{
+    perBitClear(reg, bit);
+    perBitClear(reg, bits...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void perBitToggle(volatile T& reg, const uint8_t bit) { reg ^= static_cast<T>(1U << bit); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Bits>
+void perBitToggle(volatile T& reg, const uint8_t bit, const Bits... bits)
+{
+    perBitToggle(reg, bit);
+    perBitToggle(reg, bits...);
+}
+
+} // namespace
+
+// The setup of the ADC in adc.cpp, outside the I/O space.
+extern "C" void per_bit_set_adcsra() { perBitSet(ADCSRA, ADEN, ADSC, ADPS0, ADPS1, ADPS2); }
+extern "C" void folded_set_adcsra() { utils::set(ADCSRA, ADEN, ADSC, ADPS0, ADPS1, ADPS2); }
+
+// Bits of a port in the I/O space, where single bits compile into SBI/CBI.
+extern "C" void per_bit_clear_portb() { perBitClear(PORTB, PORTB0, PORTB1, PORTB2); }
+extern "C" void folded_clear_portb() { utils::clear(PORTB, PORTB0, PORTB1, PORTB2); }
+
+extern "C" void per_bit_toggle_portb() { perBitToggle(PORTB, PORTB3, PORTB4); }
+extern "C" void folded_toggle_portb() { utils::toggle(PORTB, PORTB3, PORTB4); }
+
+// Selection of the prescaler, done by clearing the field and setting the new
+// value before utils::write existed.
+extern "C" void per_bit_write_adcsra(const uint8_t prescaler)
+{
+    ADCSRA &= static_cast<uint8_t>(~utils::mask<uint8_t>(ADPS0, ADPS1, ADPS2));
+    ADCSRA |= static_cast<uint8_t>(prescaler & utils::mask<uint8_t>(ADPS0, ADPS1, ADPS2));
+}
+
+extern "C" void folded_write_adcsra(const uint8_t prescaler)
+{
+    utils::write(ADCSRA, utils::mask<uint8_t>(ADPS0, ADPS1, ADPS2), prescaler);
+}
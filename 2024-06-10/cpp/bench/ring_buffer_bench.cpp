@@ -0,0 +1,86 @@
+/********************************************************************************
+ * @brief Throughput benchmark of container::RingBuffer.
+ *
+ * @note Values are passed through the buffer in batches of half its size,
+ *       like an interrupt filling the buffer between two passes of the main
+ *       loop. The baseline is a std::queue guarded by a std::mutex, i.e. the
+ *       locked alternative to the lock-free protocol. Both run in one thread,
+ *       so the numbers show the cost of the protocol rather than of contention;
+ *       see ring_buffer_stress.cpp for the two-thread correctness test.
+ ********************************************************************************/
+#include <stdio.h>
+
+#include <mutex>
+#include <queue>
+
+#include "../ring_buffer.h"
+#include "bench.h"
+
+namespace
+{
+
+constexpr size_t NumBatches{1024};
+
+bench::Gate gate{};
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void benchmark(const char* type)
+{
+    constexpr size_t BatchSize{Size / 2};
+
+    container::RingBuffer<T, Size> buffer{};
+    const auto ringBuffer{bench::measure([&]
+    {
+        uint32_t sum{};
+        for (size_t batch{}; batch < NumBatches; ++batch)
+        {
+            for (size_t i{}; i < BatchSize; ++i) { buffer.push(static_cast<T>(i)); }
+            T value{};
+            while (buffer.pop(value)) { sum += value; }
+        }
+        bench::keep(sum);
+    }, NumBatches * BatchSize)};
+
+    std::mutex mutex{};
+    std::queue<T> queue{};
+    const auto lockedQueue{bench::measure([&]
+    {
+        uint32_t sum{};
+        for (size_t batch{}; batch < NumBatches; ++batch)
+        {
+            for (size_t i{}; i < BatchSize; ++i)
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                queue.push(static_cast<T>(i));
+            }
+            for (;;)
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                if (queue.empty()) { break; }
+                sum += queue.front();
+                queue.pop();
+            }
+        }
+        bench::keep(sum);
+    }, NumBatches * BatchSize)};
+
+    char name[64]{};
+    snprintf(name, sizeof(name), "RingBuffer<%s, %zu> push + pop", type, Size);
+    bench::print(name, ringBuffer, lockedQueue);
+    gate.checkAllocations(name, ringBuffer, 0U);
+    gate.checkRatio(name, ringBuffer, lockedQueue, 1.0);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    bench::printHeader("RingBuffer against std::queue with std::mutex (baseline)");
+    benchmark<uint8_t, 16>("uint8_t");
+    benchmark<uint8_t, 128>("uint8_t");
+    benchmark<uint32_t, 16>("uint32_t");
+    benchmark<uint32_t, 128>("uint32_t");
+    return gate.result();
+}
@@ -0,0 +1,83 @@
+/********************************************************************************
+ * @brief Stress test of container::RingBuffer with a producer and a consumer
+ *        thread, built with ThreadSanitizer.
+ *
+ * @note The producer pushes a numbered sequence as fast as possible, while the
+ *       consumer pops it and checks that no element is lost, repeated,
+ *       reordered or torn. Each element holds the sequence number and its
+ *       complement, so a partially written element is detected. A data race
+ *       in the acquire/release protocol of the indexes or the elements is
+ *       reported by ThreadSanitizer, which fails the test.
+ ********************************************************************************/
+#include <stdio.h>
+
+#include <thread>
+
+#include "../ring_buffer.h"
+
+namespace
+{
+
+constexpr uint32_t NumValues{2000000UL};
+
+/********************************************************************************
+ * @brief Element larger than the indexes, so that it can't be copied atomically.
+ ********************************************************************************/
+struct Element
+{
+    uint32_t sequence;
+    uint32_t complement;
+};
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+bool runStress()
+{
+    container::RingBuffer<Element, Size> buffer{};
+    uint32_t numErrors{};
+    uint32_t numFull{};
+
+    std::thread producer{[&]
+    {
+        for (uint32_t sequence{}; sequence < NumValues;)
+        {
+            if (buffer.push(Element{sequence, ~sequence})) { sequence++; }
+            else
+            {
+                numFull++;
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    for (uint32_t expected{}; expected < NumValues;)
+    {
+        Element element{};
+        if (!buffer.pop(element))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        if (element.sequence != expected || element.complement != ~expected) { numErrors++; }
+        expected = element.sequence + 1U;
+    }
+    producer.join();
+
+    const bool passed{numErrors == 0 && buffer.empty()};
+    printf("RingBuffer<Element, %zu>: %lu values, %lu sequence errors, producer found the "
+           "buffer full %lu times: %s\n", Size, static_cast<unsigned long>(NumValues),
+           static_cast<unsigned long>(numErrors), static_cast<unsigned long>(numFull),
+           passed ? "passed" : "FAILED");
+    return passed;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    const bool smallest{runStress<2>()};
+    const bool medium{runStress<64>()};
+    const bool largest{runStress<128>()};
+    return smallest && medium && largest ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+/********************************************************************************
+ * @brief Thin host replacement of <avr/io.h> for the benchmarks.
+ *
+ * @note The I/O registers of the ATmega328P are mapped onto a plain array of
+ *       volatile bytes at their data memory addresses, so register helpers
+ *       such as utils::set and utils::clear can be run on the host with the
+ *       register names used by the drivers. Only the registers and bits used
+ *       by the benchmarks are declared.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace shim
+{
+
+/********************************************************************************
+ * @brief The data memory addresses 0x00 - 0xFF, which hold the I/O registers.
+ ********************************************************************************/
+inline volatile uint8_t registers[256]{};
+
+} // namespace shim
+
+#define _SFR_MEM8(address) (shim::registers[address])
+
+#define PINB  _SFR_MEM8(0x23)
+#define DDRB  _SFR_MEM8(0x24)
+#define PORTB _SFR_MEM8(0x25)
+#define PINC  _SFR_MEM8(0x26)
+#define DDRC  _SFR_MEM8(0x27)
+#define PORTC _SFR_MEM8(0x28)
+#define PIND  _SFR_MEM8(0x29)
+#define DDRD  _SFR_MEM8(0x2A)
+#define PORTD _SFR_MEM8(0x2B)
+#define ADCSRA _SFR_MEM8(0x7A)
+
+#define PORTB0 0
+#define PORTB1 1
+#define PORTB2 2
+#define PORTB3 3
+#define PORTB4 4
+#define PORTB5 5
+#define PORTB6 6
+#define PORTB7 7
+
+#define ADPS0 0
+#define ADPS1 1
+#define ADPS2 2
+#define ADIE  3
+#define ADIF  4
+#define ADATE 5
+#define ADSC  6
+#define ADEN  7
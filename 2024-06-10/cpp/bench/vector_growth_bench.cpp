@@ -0,0 +1,136 @@
+/********************************************************************************
+ * @brief Benchmark of the allocations performed by container::Vector for
+ *        pushBack-heavy workloads.
+ *
+ * @note The baseline reallocates the storage on every push and pop, like
+ *       container::Vector did before it got a separate capacity. The gate
+ *       checks the number of allocations, which doesn't depend on the host:
+ *       the capacity grows 4, 8, 16, ..., so filling a 200-element buffer
+ *       takes 7 allocations instead of 200.
+ ********************************************************************************/
+#include <stdio.h>
+
+#include "../vector.h"
+#include "bench.h"
+
+namespace
+{
+
+bench::Gate gate{};
+
+/********************************************************************************
+ * @brief Vector reallocating its storage to the exact size on every push and
+ *        pop, i.e. the previous implementation of container::Vector.
+ ********************************************************************************/
+template <typename T>
+class ReallocatingVector
+{
+public:
+    ~ReallocatingVector() { utils::deleteMemory(myData); }
+
+    bool pushBack(const T& value)
+    {
+        auto copy{utils::reallocMemory<T>(myData, mySize + 1)};
+        if (copy == nullptr) { return false; }
+        myData = copy;
+        myData[mySize++] = value;
+        return true;
+    }
+
+    void popBack()
+    {
+        if (mySize == 0) { return; }
+        if (--mySize == 0) { utils::deleteMemory(myData); }
+        else { myData = utils::reallocMemory<T>(myData, mySize); }
+    }
+
+private:
+    T* myData{nullptr};
+    size_t mySize{};
+};
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t expectedAllocations(const size_t size)
+{
+    uint32_t allocations{};
+    for (size_t capacity{}; capacity < size; capacity = capacity > 0 ? 2 * capacity : 4)
+    {
+        allocations++;
+    }
+    return allocations;
+}
+
+static_assert(expectedAllocations(200) == 7, "Filling 200 elements must take 7 allocations!");
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+void benchmarkPush()
+{
+    char name[64]{};
+    const auto push{bench::measure([]
+    {
+        container::Vector<uint16_t> vector{};
+        for (size_t i{}; i < Size; ++i) { vector.pushBack(static_cast<uint16_t>(i)); }
+        bench::keep(vector);
+    }, Size)};
+    const auto reallocating{bench::measure([]
+    {
+        ReallocatingVector<uint16_t> vector{};
+        for (size_t i{}; i < Size; ++i) { vector.pushBack(static_cast<uint16_t>(i)); }
+        bench::keep(vector);
+    }, Size)};
+    snprintf(name, sizeof(name), "pushBack %zu", Size);
+    bench::print(name, push, reallocating);
+    gate.checkAllocations(name, push, expectedAllocations(Size));
+
+    const auto reserved{bench::measure([]
+    {
+        container::Vector<uint16_t> vector{};
+        vector.reserve(Size);
+        for (size_t i{}; i < Size; ++i) { vector.pushBack(static_cast<uint16_t>(i)); }
+        bench::keep(vector);
+    }, Size)};
+    snprintf(name, sizeof(name), "reserve + pushBack %zu", Size);
+    bench::print(name, reserved, reallocating);
+    gate.checkAllocations(name, reserved, 1U);
+
+    container::Vector<uint16_t> vector{};
+    ReallocatingVector<uint16_t> reallocatingVector{};
+    const auto pushPop{bench::measure([&]
+    {
+        for (size_t i{}; i < Size; ++i) { vector.pushBack(static_cast<uint16_t>(i)); }
+        for (size_t i{}; i < Size; ++i) { vector.popBack(); }
+    }, 2 * Size)};
+    const auto reallocatingPushPop{bench::measure([&]
+    {
+        for (size_t i{}; i < Size; ++i) { reallocatingVector.pushBack(static_cast<uint16_t>(i)); }
+        for (size_t i{}; i < Size; ++i) { reallocatingVector.popBack(); }
+    }, 2 * Size)};
+    snprintf(name, sizeof(name), "pushBack + popBack %zu", Size);
+    bench::print(name, pushPop, reallocatingPushPop);
+
+    // The first run allocates the capacity, later runs reuse it.
+    gate.checkAllocations(name, pushPop, expectedAllocations(Size));
+    const auto before{bench::allocationCount()};
+    for (size_t i{}; i < Size; ++i) { vector.pushBack(static_cast<uint16_t>(i)); }
+    for (size_t i{}; i < Size; ++i) { vector.popBack(); }
+    snprintf(name, sizeof(name), "pushBack + popBack %zu reuses the capacity", Size);
+    gate.check(name, bench::allocationCount() == before);
+
+    for (size_t i{}; i < Size / 2; ++i) { vector.pushBack(static_cast<uint16_t>(i)); }
+    vector.shrinkToFit();
+    snprintf(name, sizeof(name), "shrinkToFit %zu releases the unused capacity", Size);
+    gate.check(name, vector.capacity() == Size / 2);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main()
+{
+    bench::printHeader("Vector with capacity against reallocation per push (baseline)");
+    benchmarkPush<16>();
+    benchmarkPush<200>();
+    benchmarkPush<1024>();
+    return gate.result();
+}
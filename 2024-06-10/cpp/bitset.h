@@ -0,0 +1,227 @@
+/********************************************************************************
+ * @brief Implementation of fixed-size bitsets.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of fixed-size bitsets. The bits are stored in
+ *        bytes, which is the native word size of the AVR, and all operations
+ *        except those on single bits are performed a byte at a time.
+ *
+ * @tparam NumBits The number of bits in the set.
+ *
+ * @note The number of bits must exceed 0, else a compilation error will be
+ *       generated.
+ ********************************************************************************/
+template <size_t NumBits>
+class Bitset
+{
+public:
+    /********************************************************************************
+     * @brief Creates bitset with all bits cleared.
+     ********************************************************************************/
+    constexpr Bitset();
+
+    /********************************************************************************
+     * @brief Sets the bit at specified index.
+     *
+     * @param index Index of the bit to set.
+     *
+     * @return True if the bit was set, false if the index is out of range.
+     ********************************************************************************/
+    constexpr bool set(const size_t index);
+
+    /********************************************************************************
+     * @brief Clears the bit at specified index.
+     *
+     * @param index Index of the bit to clear.
+     *
+     * @return True if the bit was cleared, false if the index is out of range.
+     ********************************************************************************/
+    constexpr bool reset(const size_t index);
+
+    /********************************************************************************
+     * @brief Toggles the bit at specified index.
+     *
+     * @param index Index of the bit to toggle.
+     *
+     * @return True if the bit was toggled, false if the index is out of range.
+     ********************************************************************************/
+    constexpr bool flip(const size_t index);
+
+    /********************************************************************************
+     * @brief Indicates if the bit at specified index is set.
+     *
+     * @param index Index of the bit to read.
+     *
+     * @return True if the bit is set, false if it's cleared or the index is out
+     *         of range.
+     ********************************************************************************/
+    constexpr bool test(const size_t index) const;
+
+    /********************************************************************************
+     * @brief Sets all bits.
+     ********************************************************************************/
+    constexpr void setAll();
+
+    /********************************************************************************
+     * @brief Clears all bits.
+     ********************************************************************************/
+    constexpr void resetAll();
+
+    /********************************************************************************
+     * @brief Returns the number of set bits.
+     *
+     * @return The number of set bits as an unsigned integer.
+     ********************************************************************************/
+    constexpr size_t count() const;
+
+    /********************************************************************************
+     * @brief Indicates if any bit is set.
+     *
+     * @return True if at least one bit is set, else false.
+     ********************************************************************************/
+    constexpr bool any() const;
+
+    /********************************************************************************
+     * @brief Indicates if no bit is set.
+     *
+     * @return True if all bits are cleared, else false.
+     ********************************************************************************/
+    constexpr bool none() const;
+
+    /********************************************************************************
+     * @brief Indicates if all bits are set.
+     *
+     * @return True if all bits are set, else false.
+     ********************************************************************************/
+    constexpr bool all() const;
+
+    /********************************************************************************
+     * @brief Finds the first set bit. The set bits can be iterated via
+     *
+     *            for (auto i{bits.findFirst()}; i < bits.size(); i = bits.findNext(i))
+     *
+     * @return Index of the first set bit, or the size of the set if no bit is set.
+     ********************************************************************************/
+    constexpr size_t findFirst() const;
+
+    /********************************************************************************
+     * @brief Finds the first set bit after specified index.
+     *
+     * @param index Index of the bit to search after.
+     *
+     * @return Index of the next set bit, or the size of the set if no further bit
+     *         is set.
+     ********************************************************************************/
+    constexpr size_t findNext(const size_t index) const;
+
+    /********************************************************************************
+     * @brief Clears all bits that aren't set in referenced other bitset.
+     *
+     * @param other Reference to other bitset.
+     *
+     * @return Reference to the bitset.
+     ********************************************************************************/
+    constexpr Bitset& operator&=(const Bitset& other);
+
+    /********************************************************************************
+     * @brief Sets all bits that are set in referenced other bitset.
+     *
+     * @param other Reference to other bitset.
+     *
+     * @return Reference to the bitset.
+     ********************************************************************************/
+    constexpr Bitset& operator|=(const Bitset& other);
+
+    /********************************************************************************
+     * @brief Toggles all bits that are set in referenced other bitset.
+     *
+     * @param other Reference to other bitset.
+     *
+     * @return Reference to the bitset.
+     ********************************************************************************/
+    constexpr Bitset& operator^=(const Bitset& other);
+
+    /********************************************************************************
+     * @brief Provides the intersection of the bitset and referenced other bitset.
+     *
+     * @param other Reference to other bitset.
+     *
+     * @return Bitset containing the bits set in both bitsets.
+     ********************************************************************************/
+    constexpr Bitset operator&(const Bitset& other) const;
+
+    /********************************************************************************
+     * @brief Provides the union of the bitset and referenced other bitset.
+     *
+     * @param other Reference to other bitset.
+     *
+     * @return Bitset containing the bits set in either bitset.
+     ********************************************************************************/
+    constexpr Bitset operator|(const Bitset& other) const;
+
+    /********************************************************************************
+     * @brief Provides the symmetric difference of the bitset and referenced other
+     *        bitset.
+     *
+     * @param other Reference to other bitset.
+     *
+     * @return Bitset containing the bits set in exactly one of the bitsets.
+     ********************************************************************************/
+    constexpr Bitset operator^(const Bitset& other) const;
+
+    /********************************************************************************
+     * @brief Provides the complement of the bitset.
+     *
+     * @return Bitset where every bit is toggled.
+     ********************************************************************************/
+    constexpr Bitset operator~() const;
+
+    /********************************************************************************
+     * @brief Indicates if the bitset and referenced other bitset are equal.
+     *
+     * @param other Reference to other bitset.
+     *
+     * @return True if the same bits are set in both bitsets, else false.
+     ********************************************************************************/
+    constexpr bool operator==(const Bitset& other) const;
+
+    /********************************************************************************
+     * @brief Indicates if the bitset and referenced other bitset differ.
+     *
+     * @param other Reference to other bitset.
+     *
+     * @return True if the bitsets differ, else false.
+     ********************************************************************************/
+    constexpr bool operator!=(const Bitset& other) const;
+
+    /********************************************************************************
+     * @brief Returns the size of the bitset.
+     *
+     * @return The number of bits in the set.
+     ********************************************************************************/
+    static constexpr size_t size();
+
+private:
+    static_assert(NumBits > 0, "Bitset size cannot be set to 0!");
+    static constexpr size_t WordBits{8};
+    static constexpr size_t NumWords{(NumBits + WordBits - 1) / WordBits};
+    static constexpr uint8_t LastWordMask{
+        NumBits % WordBits == 0 ? 0xFF : (1 << (NumBits % WordBits)) - 1};
+
+    static constexpr uint8_t mask(const size_t index);
+    static constexpr size_t countBits(uint8_t word);
+    static constexpr size_t lowestBit(const uint8_t word);
+
+    uint8_t myWords[NumWords]{};
+};
+
+} // namespace container
+
+#include "bitset_impl.h"
\ No newline at end of file
@@ -0,0 +1,237 @@
+/********************************************************************************
+ * @brief Implementation details for the container::Bitset class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr Bitset<NumBits>::Bitset() = default;
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr bool Bitset<NumBits>::set(const size_t index)
+{
+    if (index >= NumBits) { return false; }
+    myWords[index / WordBits] |= mask(index);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr bool Bitset<NumBits>::reset(const size_t index)
+{
+    if (index >= NumBits) { return false; }
+    myWords[index / WordBits] &= ~mask(index);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr bool Bitset<NumBits>::flip(const size_t index)
+{
+    if (index >= NumBits) { return false; }
+    myWords[index / WordBits] ^= mask(index);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr bool Bitset<NumBits>::test(const size_t index) const
+{
+    return index < NumBits ? (myWords[index / WordBits] & mask(index)) != 0 : false;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr void Bitset<NumBits>::setAll()
+{
+    for (auto& word : myWords) { word = 0xFF; }
+    myWords[NumWords - 1] = LastWordMask;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr void Bitset<NumBits>::resetAll()
+{
+    for (auto& word : myWords) { word = 0; }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr size_t Bitset<NumBits>::count() const
+{
+    size_t count{};
+    for (const auto& word : myWords) { count += countBits(word); }
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr bool Bitset<NumBits>::any() const
+{
+    for (const auto& word : myWords)
+    {
+        if (word != 0) { return true; }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr bool Bitset<NumBits>::none() const { return !any(); }
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr bool Bitset<NumBits>::all() const
+{
+    for (size_t i{}; i < NumWords - 1; ++i)
+    {
+        if (myWords[i] != 0xFF) { return false; }
+    }
+    return myWords[NumWords - 1] == LastWordMask;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr size_t Bitset<NumBits>::findFirst() const
+{
+    for (size_t i{}; i < NumWords; ++i)
+    {
+        if (myWords[i] != 0) { return i * WordBits + lowestBit(myWords[i]); }
+    }
+    return NumBits;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr size_t Bitset<NumBits>::findNext(const size_t index) const
+{
+    const auto next{index + 1};
+    if (next >= NumBits) { return NumBits; }
+
+    auto i{next / WordBits};
+    const uint8_t word = myWords[i] & static_cast<uint8_t>(0xFF << (next % WordBits));
+    if (word != 0) { return i * WordBits + lowestBit(word); }
+
+    for (++i; i < NumWords; ++i)
+    {
+        if (myWords[i] != 0) { return i * WordBits + lowestBit(myWords[i]); }
+    }
+    return NumBits;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr Bitset<NumBits>& Bitset<NumBits>::operator&=(const Bitset& other)
+{
+    for (size_t i{}; i < NumWords; ++i) { myWords[i] &= other.myWords[i]; }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr Bitset<NumBits>& Bitset<NumBits>::operator|=(const Bitset& other)
+{
+    for (size_t i{}; i < NumWords; ++i) { myWords[i] |= other.myWords[i]; }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr Bitset<NumBits>& Bitset<NumBits>::operator^=(const Bitset& other)
+{
+    for (size_t i{}; i < NumWords; ++i) { myWords[i] ^= other.myWords[i]; }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr Bitset<NumBits> Bitset<NumBits>::operator&(const Bitset& other) const
+{
+    Bitset result{*this};
+    result &= other;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr Bitset<NumBits> Bitset<NumBits>::operator|(const Bitset& other) const
+{
+    Bitset result{*this};
+    result |= other;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr Bitset<NumBits> Bitset<NumBits>::operator^(const Bitset& other) const
+{
+    Bitset result{*this};
+    result ^= other;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr Bitset<NumBits> Bitset<NumBits>::operator~() const
+{
+    Bitset result{};
+    for (size_t i{}; i < NumWords; ++i) { result.myWords[i] = ~myWords[i]; }
+    result.myWords[NumWords - 1] &= LastWordMask;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr bool Bitset<NumBits>::operator==(const Bitset& other) const
+{
+    for (size_t i{}; i < NumWords; ++i)
+    {
+        if (myWords[i] != other.myWords[i]) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr bool Bitset<NumBits>::operator!=(const Bitset& other) const
+{
+    return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr size_t Bitset<NumBits>::size() { return NumBits; }
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr uint8_t Bitset<NumBits>::mask(const size_t index)
+{
+    return static_cast<uint8_t>(1 << (index % WordBits));
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr size_t Bitset<NumBits>::countBits(uint8_t word)
+{
+    // Clear the lowest set bit until no bits remain.
+    size_t count{};
+    for (; word != 0; word &= word - 1) { count++; }
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t NumBits>
+constexpr size_t Bitset<NumBits>::lowestBit(const uint8_t word)
+{
+    size_t index{};
+    for (uint8_t bit{1}; (word & bit) == 0; bit <<= 1) { index++; }
+    return index;
+}
+
+} // namespace container
\ No newline at end of file
@@ -0,0 +1,585 @@
+/********************************************************************************
+ * @brief Implementation of double-ended queues of any data type.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "allocation.h"
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of double-ended queues. The elements are
+ *        stored in fixed-size blocks, which are referenced by a circular block
+ *        map. Values can be pushed and popped at both ends in constant time,
+ *        and each element can be accessed by index in constant time.
+ *
+ *        Blocks emptied by a pop operation are kept in the block map and
+ *        reused by later push operations, so a deque used as a FIFO queue
+ *        stops allocating once it has reached its peak size. The blocks are
+ *        released via shrinkToFit or clear.
+ *
+ * @tparam T          The data type of the deque.
+ * @tparam BlockSize  The number of elements per block (default = 16).
+ * @tparam Allocation Allocation policy used for the blocks and the block map,
+ *                    see allocation.h (default = allocation::Heap, i.e. the
+ *                    memory is allocated on the heap). The policy must support
+ *                    reallocation. All deques of the same type share the same
+ *                    allocators.
+ *
+ * @note The block size must be a power of two, else a compilation error will be
+ *       generated. Element positions are thereby computed by shifts and masks
+ *       instead of divisions, which are slow on 8-bit processors.
+ ********************************************************************************/
+template <typename T, size_t BlockSize = 16, typename Allocation = allocation::Heap>
+class Deque
+{
+public:
+    class Iterator;
+    class ConstIterator;
+
+    /********************************************************************************
+     * @brief Creates empty deque.
+     ********************************************************************************/
+    Deque();
+
+    /********************************************************************************
+     * @brief Creates deque of specified size initialized with specified start value.
+     *
+     * @param size       The starting size of the deque.
+     * @param startValue The starting value for each element (default = 0).
+     ********************************************************************************/
+    Deque(const size_t size, const T& startValue = static_cast<T>(0));
+
+    /********************************************************************************
+     * @brief Creates deque initialized with values passed as input arguments.
+     *
+     * @tparam Values... Parameter pack holding input arguments.
+     *
+     * @param values The arguments to store in newly created deque.
+     ********************************************************************************/
+    template <typename... Values>
+    Deque(const Values&&... values);
+
+    /********************************************************************************
+     * @brief Creates new deque as a copy of referenced source.
+     *
+     * @param source Reference to deque whose content is copied to the new deque.
+     ********************************************************************************/
+    Deque(const Deque& source);
+
+    /********************************************************************************
+     * @brief Moves memory from referenced source to the new deque. The source
+     *        deque is emptied after the move operation is performed.
+     *
+     * @param source Reference to deque whose content is moved to the new deque.
+     ********************************************************************************/
+    Deque(Deque&& source);
+
+    /********************************************************************************
+     * @brief Deletes deque.
+     ********************************************************************************/
+    ~Deque();
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified index in the deque.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return A reference to the element at specified index.
+     ********************************************************************************/
+    T& operator[](const size_t index);
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified index in the deque.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return A reference to the element at specified index.
+     ********************************************************************************/
+    const T& operator[](const size_t index) const;
+
+    /********************************************************************************
+     * @brief Moves memory from referenced source to assigned deque. Previous
+     *        values are cleared and the source deque is emptied after the move
+     *        operation is performed.
+     *
+     * @param source Reference to deque whose content is moved to assigned deque.
+     ********************************************************************************/
+    void operator=(Deque&& source);
+
+    /********************************************************************************
+     * @brief Pushes values to the back of the deque.
+     *
+     * @tparam NumValues The number of values to add.
+     *
+     * @param values Reference to the values to add.
+     *
+     * @return True if the values were added, else false.
+     ********************************************************************************/
+    template <size_t NumValues>
+    bool operator+=(const T (&values)[NumValues]);
+
+    /********************************************************************************
+     * @brief Returns the size of the deque.
+     *
+     * @return The size of the deque in the number of element it holds.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Returns the number of blocks held by the deque, including emptied
+     *        blocks kept for reuse.
+     *
+     * @return The number of allocated blocks.
+     ********************************************************************************/
+    size_t numBlocks() const;
+
+    /********************************************************************************
+     * @brief Clears content of the deque. All blocks and the block map are
+     *        released.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Releases blocks that don't hold any elements.
+     ********************************************************************************/
+    void shrinkToFit();
+
+    /********************************************************************************
+     * @brief Indicates if the deque is empty.
+     *
+     * @return True if the deque is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Returns the start address of the deque.
+     *
+     * @return Iterator pointing at the start address of the deque.
+     ********************************************************************************/
+    Iterator begin();
+
+    /********************************************************************************
+     * @brief Returns the start address of the deque.
+     *
+     * @return Iterator pointing at the start address of the deque.
+     ********************************************************************************/
+    ConstIterator begin() const;
+
+    /********************************************************************************
+     * @brief Returns the end address of the deque.
+     *
+     * @return Iterator pointing at the end address of the deque.
+     ********************************************************************************/
+    Iterator end();
+
+    /********************************************************************************
+     * @brief Returns the end address of the deque.
+     *
+     * @return Iterator pointing at the end address of the deque.
+     ********************************************************************************/
+    ConstIterator end() const;
+
+    /********************************************************************************
+     * @brief Returns the address of the last element of the deque.
+     *
+     * @return Iterator pointing at the last element of the deque.
+     ********************************************************************************/
+    Iterator rbegin();
+
+    /********************************************************************************
+     * @brief Returns the address of the last element of the deque.
+     *
+     * @return Iterator pointing at the last element of the deque.
+     ********************************************************************************/
+    ConstIterator rbegin() const;
+
+    /********************************************************************************
+     * @brief Returns the reverse end address of the deque.
+     *
+     * @return Iterator pointing at the reverse end of the deque.
+     ********************************************************************************/
+    Iterator rend();
+
+    /********************************************************************************
+     * @brief Returns the reverse end address of the deque.
+     *
+     * @return Iterator pointing at the reverse end of the deque.
+     ********************************************************************************/
+    ConstIterator rend() const;
+
+    /********************************************************************************
+     * @brief Resizes the deque to specified new size. Values are added or removed
+     *        at the back of the deque.
+     *
+     * @param newSize    The new size of the deque.
+     * @param startValue The starting value for each new element (default = 0).
+     *
+     * @return True if the deque was resized, else false.
+     ********************************************************************************/
+    bool resize(const size_t newSize, const T& startValue = static_cast<T>(0));
+
+    /********************************************************************************
+     * @brief Inserts value at the front of the deque.
+     *
+     * @param value Reference to the value to add.
+     *
+     * @return True if the value was added, else false.
+     ********************************************************************************/
+    bool pushFront(const T& value);
+
+    /********************************************************************************
+     * @brief Inserts value at the back of the deque.
+     *
+     * @param value Reference to the value to add.
+     *
+     * @return True if the value was added, else false.
+     ********************************************************************************/
+    bool pushBack(const T& value);
+
+    /********************************************************************************
+     * @brief Constructs value at the front of the deque.
+     *
+     * @tparam Args Parameter pack containing the constructor arguments.
+     *
+     * @param args The arguments passed to the constructor of the new value.
+     *
+     * @return True if the value was added, else false.
+     ********************************************************************************/
+    template <typename... Args>
+    bool emplaceFront(Args&&... args);
+
+    /********************************************************************************
+     * @brief Constructs value at the back of the deque.
+     *
+     * @tparam Args Parameter pack containing the constructor arguments.
+     *
+     * @param args The arguments passed to the constructor of the new value.
+     *
+     * @return True if the value was added, else false.
+     ********************************************************************************/
+    template <typename... Args>
+    bool emplaceBack(Args&&... args);
+
+    /********************************************************************************
+     * @brief Removes value at the front of the deque.
+     ********************************************************************************/
+    void popFront();
+
+    /********************************************************************************
+     * @brief Removes value at the back of the deque.
+     ********************************************************************************/
+    void popBack();
+
+private:
+    static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0,
+        "Deque block size must be a power of two!");
+    struct Block;
+    static constexpr size_t InitialMapCapacity{4};
+
+    bool copy(const Deque& source);
+    template <size_t NumValues>
+    bool addValues(const T (&values)[NumValues]);
+    T& element(const size_t index) const;
+    size_t slot(const size_t blockIndex) const;
+    bool addBlockFront();
+    bool addBlockBack();
+    bool useSlot(const size_t index);
+    bool growMap();
+    static void destroyBlock(Block* block);
+
+    using BlockAllocator = typename Allocation::template Allocator<Block>;
+    using MapAllocator = typename Allocation::template Allocator<Block*>;
+    static BlockAllocator myBlockAllocator;
+    static MapAllocator myMapAllocator;
+
+    Block** myMap{nullptr};
+    size_t myMapCapacity{};
+    size_t myFirstSlot{};
+    size_t myNumUsedBlocks{};
+    size_t myHead{};
+    size_t mySize{};
+};
+
+/********************************************************************************
+ * @brief Implementation of mutable deque iterators.
+ *
+ * @tparam T          The data type of the deque.
+ * @tparam BlockSize  The number of elements per block.
+ * @tparam Allocation Allocation policy used for the deque.
+ ********************************************************************************/
+template <typename T, size_t BlockSize, typename Allocation>
+class Deque<T, BlockSize, Allocation>::Iterator
+{
+public:
+    /********************************************************************************
+     * @brief Creates empty iterator.
+     ********************************************************************************/
+    Iterator();
+
+    /********************************************************************************
+     * @brief Creates iterator pointing at specified element of referenced deque.
+     *
+     * @param deque Pointer to the deque holding the element.
+     * @param index Index of the element.
+     ********************************************************************************/
+    Iterator(Deque* deque, const size_t index);
+
+    /********************************************************************************
+     * @brief Prefix increment operator, sets the iterator to point at next element.
+     ********************************************************************************/
+    void operator++();
+
+    /********************************************************************************
+     * @brief Postfix increment operator, sets the iterator to point at next element.
+     ********************************************************************************/
+    void operator++(int);
+
+    /********************************************************************************
+     * @brief Prefix decrement operator, sets the iterator to point at previous
+     *        element.
+     ********************************************************************************/
+    void operator--();
+
+    /********************************************************************************
+     * @brief Postfix decrement operator, sets the iterator to point at previous
+     *        element.
+     ********************************************************************************/
+    void operator--(int);
+
+    /********************************************************************************
+     * @brief Addition operator, increments the iterator specified number of times
+     *        in constant time.
+     *
+     * @param numIncrements The number of times the iterator will be incremented.
+     ********************************************************************************/
+    void operator+=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Subtraction operator, decrements the iterator specified number of
+     *        times in constant time.
+     *
+     * @param numIncrements The number of times the iterator will be decremented.
+     ********************************************************************************/
+    void operator-=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Equality operator, checks if the iterator points at the same element
+     *        as referenced other iterator.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same element, else false.
+     ********************************************************************************/
+    bool operator==(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Inequality operator, checks if the iterator and referenced other
+     *        iterator point at different elements.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at different elements, else false.
+     ********************************************************************************/
+    bool operator!=(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Greater than operator, checks if the iterator points at an element
+     *        placed after the element referenced other iterator points at.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterator points at a later element, else false.
+     ********************************************************************************/
+    bool operator>(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Less than operator, checks if the iterator points at an element
+     *        placed before the element referenced other iterator points at.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterator points at an earlier element, else false.
+     ********************************************************************************/
+    bool operator<(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Greater than or equal operator, checks if the iterator points at the
+     *        same element or an element placed after the element referenced other
+     *        iterator points at.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterator points at the same or a later element, else false.
+     ********************************************************************************/
+    bool operator>=(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Less than or equal operator, checks if the iterator points at the
+     *        same element or an element placed before the element referenced other
+     *        iterator points at.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterator points at the same or an earlier element,
+     *         else false.
+     ********************************************************************************/
+    bool operator<=(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Dereference operator, provides a reference to the element the
+     *        iterator is pointing at.
+     *
+     * @return Reference to the element the iterator is pointing at.
+     ********************************************************************************/
+    T& operator*();
+
+private:
+    Deque* myDeque{nullptr};
+    size_t myIndex{};
+};
+
+/********************************************************************************
+ * @brief Implementation of constant deque iterators.
+ *
+ * @tparam T          The data type of the deque.
+ * @tparam BlockSize  The number of elements per block.
+ * @tparam Allocation Allocation policy used for the deque.
+ ********************************************************************************/
+template <typename T, size_t BlockSize, typename Allocation>
+class Deque<T, BlockSize, Allocation>::ConstIterator
+{
+public:
+    /********************************************************************************
+     * @brief Creates empty iterator.
+     ********************************************************************************/
+    ConstIterator();
+
+    /********************************************************************************
+     * @brief Creates iterator pointing at specified element of referenced deque.
+     *
+     * @param deque Pointer to the deque holding the element.
+     * @param index Index of the element.
+     ********************************************************************************/
+    ConstIterator(const Deque* deque, const size_t index);
+
+    /********************************************************************************
+     * @brief Prefix increment operator, sets the iterator to point at next element.
+     ********************************************************************************/
+    void operator++();
+
+    /********************************************************************************
+     * @brief Postfix increment operator, sets the iterator to point at next element.
+     ********************************************************************************/
+    void operator++(int);
+
+    /********************************************************************************
+     * @brief Prefix decrement operator, sets the iterator to point at previous
+     *        element.
+     ********************************************************************************/
+    void operator--();
+
+    /********************************************************************************
+     * @brief Postfix decrement operator, sets the iterator to point at previous
+     *        element.
+     ********************************************************************************/
+    void operator--(int);
+
+    /********************************************************************************
+     * @brief Addition operator, increments the iterator specified number of times
+     *        in constant time.
+     *
+     * @param numIncrements The number of times the iterator will be incremented.
+     ********************************************************************************/
+    void operator+=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Subtraction operator, decrements the iterator specified number of
+     *        times in constant time.
+     *
+     * @param numIncrements The number of times the iterator will be decremented.
+     ********************************************************************************/
+    void operator-=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Equality operator, checks if the iterator points at the same element
+     *        as referenced other iterator.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same element, else false.
+     ********************************************************************************/
+    bool operator==(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Inequality operator, checks if the iterator and referenced other
+     *        iterator point at different elements.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at different elements, else false.
+     ********************************************************************************/
+    bool operator!=(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Greater than operator, checks if the iterator points at an element
+     *        placed after the element referenced other iterator points at.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterator points at a later element, else false.
+     ********************************************************************************/
+    bool operator>(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Less than operator, checks if the iterator points at an element
+     *        placed before the element referenced other iterator points at.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterator points at an earlier element, else false.
+     ********************************************************************************/
+    bool operator<(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Greater than or equal operator, checks if the iterator points at the
+     *        same element or an element placed after the element referenced other
+     *        iterator points at.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterator points at the same or a later element, else false.
+     ********************************************************************************/
+    bool operator>=(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Less than or equal operator, checks if the iterator points at the
+     *        same element or an element placed before the element referenced other
+     *        iterator points at.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterator points at the same or an earlier element,
+     *         else false.
+     ********************************************************************************/
+    bool operator<=(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Dereference operator, provides a reference to the element the
+     *        iterator is pointing at.
+     *
+     * @return Reference to the element the iterator is pointing at.
+     ********************************************************************************/
+    const T& operator*() const;
+
+private:
+    const Deque* myDeque{nullptr};
+    size_t myIndex{};
+};
+
+} // namespace container
+
+#include "deque_impl.h"
\ No newline at end of file
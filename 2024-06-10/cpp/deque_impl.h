@@ -0,0 +1,608 @@
+/********************************************************************************
+ * @brief Implementation details for the container::Deque class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+#include "utils.h"
+
+namespace container
+{
+
+template <typename T, size_t BlockSize, typename Allocation>
+struct Deque<T, BlockSize, Allocation>::Block
+{
+    T data[BlockSize];
+};
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::BlockAllocator
+    Deque<T, BlockSize, Allocation>::myBlockAllocator{};
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::MapAllocator
+    Deque<T, BlockSize, Allocation>::myMapAllocator{};
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+Deque<T, BlockSize, Allocation>::Deque() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+Deque<T, BlockSize, Allocation>::Deque(const size_t size, const T& startValue)
+{
+    resize(size, startValue);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+template <typename... Values>
+Deque<T, BlockSize, Allocation>::Deque(const Values&&... values)
+{
+    const T array[sizeof...(values)]{static_cast<T>(values)...};
+    addValues(array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+Deque<T, BlockSize, Allocation>::Deque(const Deque& source)
+{
+    copy(source);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+Deque<T, BlockSize, Allocation>::Deque(Deque&& source)
+{
+    myMap = source.myMap;
+    myMapCapacity = source.myMapCapacity;
+    myFirstSlot = source.myFirstSlot;
+    myNumUsedBlocks = source.myNumUsedBlocks;
+    myHead = source.myHead;
+    mySize = source.mySize;
+    source.myMap = nullptr;
+    source.myMapCapacity = 0;
+    source.myFirstSlot = 0;
+    source.myNumUsedBlocks = 0;
+    source.myHead = 0;
+    source.mySize = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+Deque<T, BlockSize, Allocation>::~Deque() { clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+T& Deque<T, BlockSize, Allocation>::operator[](const size_t index)
+{
+    return element(index);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+const T& Deque<T, BlockSize, Allocation>::operator[](const size_t index) const
+{
+    return element(index);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::operator=(Deque&& source)
+{
+    if (&source == this) { return; }
+    clear();
+    myMap = source.myMap;
+    myMapCapacity = source.myMapCapacity;
+    myFirstSlot = source.myFirstSlot;
+    myNumUsedBlocks = source.myNumUsedBlocks;
+    myHead = source.myHead;
+    mySize = source.mySize;
+    source.myMap = nullptr;
+    source.myMapCapacity = 0;
+    source.myFirstSlot = 0;
+    source.myNumUsedBlocks = 0;
+    source.myHead = 0;
+    source.mySize = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+template <size_t NumValues>
+bool Deque<T, BlockSize, Allocation>::operator+=(const T (&values)[NumValues])
+{
+    return addValues(values);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+size_t Deque<T, BlockSize, Allocation>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+size_t Deque<T, BlockSize, Allocation>::numBlocks() const
+{
+    size_t count{};
+    for (size_t i{}; i < myMapCapacity; ++i)
+    {
+        if (myMap[i] != nullptr) { count++; }
+    }
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::clear()
+{
+    for (size_t i{}; i < myMapCapacity; ++i)
+    {
+        if (myMap[i] != nullptr) { destroyBlock(myMap[i]); }
+    }
+    if (myMap != nullptr) { myMapAllocator.deallocate(myMap); }
+    myMap = nullptr;
+    myMapCapacity = 0;
+    myFirstSlot = 0;
+    myNumUsedBlocks = 0;
+    myHead = 0;
+    mySize = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::shrinkToFit()
+{
+    for (size_t i{myNumUsedBlocks}; i < myMapCapacity; ++i)
+    {
+        auto& block{myMap[slot(i)]};
+        if (block != nullptr)
+        {
+            destroyBlock(block);
+            block = nullptr;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::Iterator Deque<T, BlockSize, Allocation>::begin()
+{
+    return Iterator{this, 0};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::ConstIterator
+    Deque<T, BlockSize, Allocation>::begin() const
+{
+    return ConstIterator{this, 0};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::Iterator Deque<T, BlockSize, Allocation>::end()
+{
+    return Iterator{this, mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::ConstIterator
+    Deque<T, BlockSize, Allocation>::end() const
+{
+    return ConstIterator{this, mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::Iterator Deque<T, BlockSize, Allocation>::rbegin()
+{
+    return Iterator{this, mySize - 1};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::ConstIterator
+    Deque<T, BlockSize, Allocation>::rbegin() const
+{
+    return ConstIterator{this, mySize - 1};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::Iterator Deque<T, BlockSize, Allocation>::rend()
+{
+    return Iterator{this, SIZE_MAX};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+typename Deque<T, BlockSize, Allocation>::ConstIterator
+    Deque<T, BlockSize, Allocation>::rend() const
+{
+    return ConstIterator{this, SIZE_MAX};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::resize(const size_t newSize, const T& startValue)
+{
+    while (mySize < newSize)
+    {
+        if (!pushBack(startValue)) { return false; }
+    }
+    while (mySize > newSize) { popBack(); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::pushFront(const T& value)
+{
+    return emplaceFront(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::pushBack(const T& value)
+{
+    return emplaceBack(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+template <typename... Args>
+bool Deque<T, BlockSize, Allocation>::emplaceFront(Args&&... args)
+{
+    if (myHead == 0)
+    {
+        if (!addBlockFront()) { return false; }
+        myHead = BlockSize;
+    }
+    myHead--;
+    mySize++;
+    element(0) = T(utils::forward<Args>(args)...);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+template <typename... Args>
+bool Deque<T, BlockSize, Allocation>::emplaceBack(Args&&... args)
+{
+    if (myHead + mySize == myNumUsedBlocks * BlockSize && !addBlockBack()) { return false; }
+    element(mySize++) = T(utils::forward<Args>(args)...);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::popFront()
+{
+    if (mySize == 0) { return; }
+    mySize--;
+
+    if (mySize == 0)
+    {
+        myNumUsedBlocks = 0;
+        myHead = 0;
+    }
+    else if (++myHead == BlockSize)
+    {
+        myFirstSlot = slot(1);
+        myNumUsedBlocks--;
+        myHead = 0;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::popBack()
+{
+    if (mySize == 0) { return; }
+    mySize--;
+
+    if (mySize == 0)
+    {
+        myNumUsedBlocks = 0;
+        myHead = 0;
+    }
+    else if (myHead + mySize == (myNumUsedBlocks - 1) * BlockSize)
+    {
+        myNumUsedBlocks--;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::copy(const Deque& source)
+{
+    clear();
+    for (size_t i{}; i < source.mySize; ++i)
+    {
+        if (!pushBack(source[i])) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+template <size_t NumValues>
+bool Deque<T, BlockSize, Allocation>::addValues(const T (&values)[NumValues])
+{
+    for (size_t i{}; i < NumValues; ++i)
+    {
+        if (!pushBack(values[i])) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+T& Deque<T, BlockSize, Allocation>::element(const size_t index) const
+{
+    const auto position{myHead + index};
+    return myMap[slot(position / BlockSize)]->data[position % BlockSize];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+size_t Deque<T, BlockSize, Allocation>::slot(const size_t blockIndex) const
+{
+    return (myFirstSlot + blockIndex) & (myMapCapacity - 1);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::addBlockFront()
+{
+    if (myNumUsedBlocks == myMapCapacity && !growMap()) { return false; }
+    const auto first{(myFirstSlot - 1) & (myMapCapacity - 1)};
+    if (!useSlot(first)) { return false; }
+    myFirstSlot = first;
+    myNumUsedBlocks++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::addBlockBack()
+{
+    if (myNumUsedBlocks == myMapCapacity && !growMap()) { return false; }
+    if (!useSlot(slot(myNumUsedBlocks))) { return false; }
+    myNumUsedBlocks++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::useSlot(const size_t index)
+{
+    // Reuse the block previously emptied at this index, if any.
+    if (myMap[index] != nullptr) { return true; }
+    auto block{myBlockAllocator.allocate()};
+    if (block == nullptr) { return false; }
+    myMap[index] = utils::construct(block);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::growMap()
+{
+    const auto newCapacity{myMapCapacity > 0 ? myMapCapacity * 2 : InitialMapCapacity};
+    auto newMap{myMapAllocator.reallocate(nullptr, 0, newCapacity)};
+    if (newMap == nullptr) { return false; }
+
+    // Unroll the circular map so that the first block is placed at slot 0.
+    for (size_t i{}; i < newCapacity; ++i)
+    {
+        newMap[i] = i < myMapCapacity ? myMap[slot(i)] : nullptr;
+    }
+    if (myMap != nullptr) { myMapAllocator.deallocate(myMap); }
+    myMap = newMap;
+    myMapCapacity = newCapacity;
+    myFirstSlot = 0;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::destroyBlock(Block* block)
+{
+    block->~Block();
+    myBlockAllocator.deallocate(block);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+Deque<T, BlockSize, Allocation>::Iterator::Iterator() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+Deque<T, BlockSize, Allocation>::Iterator::Iterator(Deque* deque, const size_t index)
+    : myDeque{deque}
+    , myIndex{index} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::Iterator::operator++() { myIndex++; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::Iterator::operator++(int) { myIndex++; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::Iterator::operator--() { myIndex--; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::Iterator::operator--(int) { myIndex--; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::Iterator::operator+=(const size_t numIncrements)
+{
+    myIndex += numIncrements;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::Iterator::operator-=(const size_t numIncrements)
+{
+    myIndex -= numIncrements;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::Iterator::operator==(const Iterator& other) const
+{
+    return myDeque == other.myDeque && myIndex == other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::Iterator::operator!=(const Iterator& other) const
+{
+    return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::Iterator::operator>(const Iterator& other) const
+{
+    return myIndex > other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::Iterator::operator<(const Iterator& other) const
+{
+    return myIndex < other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::Iterator::operator>=(const Iterator& other) const
+{
+    return myIndex >= other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::Iterator::operator<=(const Iterator& other) const
+{
+    return myIndex <= other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+T& Deque<T, BlockSize, Allocation>::Iterator::operator*()
+{
+    return (*myDeque)[myIndex];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+Deque<T, BlockSize, Allocation>::ConstIterator::ConstIterator() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+Deque<T, BlockSize, Allocation>::ConstIterator::ConstIterator(const Deque* deque,
+                                                              const size_t index)
+    : myDeque{deque}
+    , myIndex{index} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::ConstIterator::operator++() { myIndex++; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::ConstIterator::operator++(int) { myIndex++; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::ConstIterator::operator--() { myIndex--; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::ConstIterator::operator--(int) { myIndex--; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::ConstIterator::operator+=(const size_t numIncrements)
+{
+    myIndex += numIncrements;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+void Deque<T, BlockSize, Allocation>::ConstIterator::operator-=(const size_t numIncrements)
+{
+    myIndex -= numIncrements;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::ConstIterator::operator==(
+    const ConstIterator& other) const
+{
+    return myDeque == other.myDeque && myIndex == other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::ConstIterator::operator!=(
+    const ConstIterator& other) const
+{
+    return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::ConstIterator::operator>(
+    const ConstIterator& other) const
+{
+    return myIndex > other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::ConstIterator::operator<(
+    const ConstIterator& other) const
+{
+    return myIndex < other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::ConstIterator::operator>=(
+    const ConstIterator& other) const
+{
+    return myIndex >= other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+bool Deque<T, BlockSize, Allocation>::ConstIterator::operator<=(
+    const ConstIterator& other) const
+{
+    return myIndex <= other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t BlockSize, typename Allocation>
+const T& Deque<T, BlockSize, Allocation>::ConstIterator::operator*() const
+{
+    return (*myDeque)[myIndex];
+}
+
+} // namespace container
\ No newline at end of file
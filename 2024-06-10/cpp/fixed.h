@@ -0,0 +1,311 @@
+/********************************************************************************
+ * @brief Implementation of signed fixed-point numbers, which replace
+ *        floating-point numbers on processors without a floating-point unit.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#include "type_traits.h"
+
+namespace utils
+{
+/********************************************************************************
+ * @brief Class for implementation of signed fixed-point numbers. The value is
+ *        stored as an integer scaled by 2^FracBits, so additions and
+ *        comparisons are plain integer operations and multiplications and
+ *        divisions are integer operations followed by a shift. On the
+ *        ATmega328P, this avoids the soft-float routines linked in when
+ *        double is used, which cost hundreds of cycles per operation.
+ *
+ *        All arithmetic is saturating, i.e. results outside the range of the
+ *        number are clamped to the smallest or largest value instead of
+ *        wrapping around. Products and quotients are rounded to the nearest
+ *        representable value.
+ *
+ * @tparam IntBits  The number of integer bits, excluding the sign bit.
+ * @tparam FracBits The number of fractional bits.
+ *
+ * @note The total number of bits, including the sign bit, must not exceed 32,
+ *       else a compilation error will be generated. The value is stored in the
+ *       smallest integer type that can hold it, i.e. 8, 16 or 32 bits.
+ ********************************************************************************/
+template <uint8_t IntBits, uint8_t FracBits>
+class Fixed
+{
+    static constexpr uint8_t TotalBits{1U + IntBits + FracBits};
+    static_assert(TotalBits <= 32U, "Fixed-point numbers can hold at most 32 bits!");
+
+public:
+    /********************************************************************************
+     * @brief The integer type holding the scaled value.
+     ********************************************************************************/
+    using Raw = typename type_traits::conditional<(TotalBits <= 8U), int8_t,
+        typename type_traits::conditional<(TotalBits <= 16U), int16_t, int32_t>::type>::type;
+
+    /********************************************************************************
+     * @brief The number of fractional bits, i.e. the scale of the raw value.
+     ********************************************************************************/
+    static constexpr uint8_t FractionalBits{FracBits};
+
+    /********************************************************************************
+     * @brief Creates fixed-point number set to 0.
+     ********************************************************************************/
+    constexpr Fixed() = default;
+
+    /********************************************************************************
+     * @brief Creates fixed-point number holding specified value. Values outside
+     *        the range of the number are saturated.
+     *
+     * @tparam T The type of the value, must be an arithmetic type.
+     *
+     * @param value The value to hold.
+     *
+     * @note Conversion from floating-point values should only be performed at
+     *       compile time, for instance when initializing constexpr constants,
+     *       else the soft-float routines are linked in anyway.
+     ********************************************************************************/
+    template <typename T>
+    constexpr Fixed(const T value);
+
+    /********************************************************************************
+     * @brief Creates fixed-point number from specified raw value.
+     *
+     * @param raw The value scaled by 2^FracBits.
+     *
+     * @return The corresponding fixed-point number.
+     ********************************************************************************/
+    static constexpr Fixed fromRaw(const Raw raw);
+
+    /********************************************************************************
+     * @brief Creates fixed-point number holding the ratio of specified integers,
+     *        rounded to the nearest representable value.
+     *
+     * @tparam T The type of the integers.
+     *
+     * @param numerator   The numerator of the ratio.
+     * @param denominator The denominator of the ratio.
+     *
+     * @return The corresponding fixed-point number. The number is saturated if
+     *         the denominator is 0.
+     ********************************************************************************/
+    template <typename T>
+    static constexpr Fixed fromRatio(const T numerator, const T denominator);
+
+    /********************************************************************************
+     * @brief Returns the largest value the number can hold.
+     *
+     * @return The largest value.
+     ********************************************************************************/
+    static constexpr Fixed max();
+
+    /********************************************************************************
+     * @brief Returns the smallest value the number can hold.
+     *
+     * @return The smallest value.
+     ********************************************************************************/
+    static constexpr Fixed min();
+
+    /********************************************************************************
+     * @brief Returns the raw value of the number.
+     *
+     * @return The value scaled by 2^FracBits.
+     ********************************************************************************/
+    constexpr Raw raw() const;
+
+    /********************************************************************************
+     * @brief Rounds the number to the nearest integer, where halves are rounded
+     *        away from zero.
+     *
+     * @tparam T The integer type to return (default = int32_t).
+     *
+     * @return The rounded number, saturated to the range of T.
+     ********************************************************************************/
+    template <typename T = int32_t>
+    constexpr T round() const;
+
+    /********************************************************************************
+     * @brief Truncates the number towards zero.
+     *
+     * @tparam T The integer type to return (default = int32_t).
+     *
+     * @return The integer part of the number, saturated to the range of T.
+     ********************************************************************************/
+    template <typename T = int32_t>
+    constexpr T truncate() const;
+
+    /********************************************************************************
+     * @brief Converts the number to a floating-point number, for instance for
+     *        printing on a host.
+     *
+     * @return The corresponding floating-point number.
+     ********************************************************************************/
+    constexpr double toDouble() const;
+
+    /********************************************************************************
+     * @brief Multiplies specified integer with the number and rounds the product
+     *        to the nearest integer. The product is computed with 32-bit integers
+     *        if the operands fit, else with 64-bit integers.
+     *
+     * @tparam Result The integer type to return (default = int32_t).
+     * @tparam T      The type of the integer to multiply.
+     *
+     * @param value The integer to multiply.
+     *
+     * @return The rounded product, saturated to the range of Result.
+     ********************************************************************************/
+    template <typename Result = int32_t, typename T>
+    constexpr Result scale(const T value) const;
+
+    /********************************************************************************
+     * @brief Returns the sum of the number and referenced other number.
+     *
+     * @param other Reference to the number to add.
+     *
+     * @return The saturated sum.
+     ********************************************************************************/
+    constexpr Fixed operator+(const Fixed& other) const;
+
+    /********************************************************************************
+     * @brief Returns the difference of the number and referenced other number.
+     *
+     * @param other Reference to the number to subtract.
+     *
+     * @return The saturated difference.
+     ********************************************************************************/
+    constexpr Fixed operator-(const Fixed& other) const;
+
+    /********************************************************************************
+     * @brief Returns the product of the number and referenced other number.
+     *
+     * @param other Reference to the number to multiply with.
+     *
+     * @return The rounded and saturated product.
+     ********************************************************************************/
+    constexpr Fixed operator*(const Fixed& other) const;
+
+    /********************************************************************************
+     * @brief Returns the quotient of the number and referenced other number.
+     *
+     * @param other Reference to the divisor.
+     *
+     * @return The rounded and saturated quotient. The quotient is saturated if
+     *         the divisor is 0.
+     ********************************************************************************/
+    constexpr Fixed operator/(const Fixed& other) const;
+
+    /********************************************************************************
+     * @brief Returns the negated number.
+     *
+     * @return The saturated negated number.
+     ********************************************************************************/
+    constexpr Fixed operator-() const;
+
+    /********************************************************************************
+     * @brief Adds referenced other number to the number.
+     *
+     * @param other Reference to the number to add.
+     *
+     * @return Reference to the number.
+     ********************************************************************************/
+    constexpr Fixed& operator+=(const Fixed& other);
+
+    /********************************************************************************
+     * @brief Subtracts referenced other number from the number.
+     *
+     * @param other Reference to the number to subtract.
+     *
+     * @return Reference to the number.
+     ********************************************************************************/
+    constexpr Fixed& operator-=(const Fixed& other);
+
+    /********************************************************************************
+     * @brief Multiplies the number with referenced other number.
+     *
+     * @param other Reference to the number to multiply with.
+     *
+     * @return Reference to the number.
+     ********************************************************************************/
+    constexpr Fixed& operator*=(const Fixed& other);
+
+    /********************************************************************************
+     * @brief Divides the number with referenced other number.
+     *
+     * @param other Reference to the divisor.
+     *
+     * @return Reference to the number.
+     ********************************************************************************/
+    constexpr Fixed& operator/=(const Fixed& other);
+
+    /********************************************************************************
+     * @brief Equality operator.
+     *
+     * @param other Reference to the number to compare with.
+     *
+     * @return True if the numbers are equal, else false.
+     ********************************************************************************/
+    constexpr bool operator==(const Fixed& other) const;
+
+    /********************************************************************************
+     * @brief Inequality operator.
+     *
+     * @param other Reference to the number to compare with.
+     *
+     * @return True if the numbers are not equal, else false.
+     ********************************************************************************/
+    constexpr bool operator!=(const Fixed& other) const;
+
+    /********************************************************************************
+     * @brief Less than operator.
+     *
+     * @param other Reference to the number to compare with.
+     *
+     * @return True if the number is less than the other number, else false.
+     ********************************************************************************/
+    constexpr bool operator<(const Fixed& other) const;
+
+    /********************************************************************************
+     * @brief Greater than operator.
+     *
+     * @param other Reference to the number to compare with.
+     *
+     * @return True if the number is greater than the other number, else false.
+     ********************************************************************************/
+    constexpr bool operator>(const Fixed& other) const;
+
+    /********************************************************************************
+     * @brief Less than or equal operator.
+     *
+     * @param other Reference to the number to compare with.
+     *
+     * @return True if the number is less than or equal to the other number,
+     *         else false.
+     ********************************************************************************/
+    constexpr bool operator<=(const Fixed& other) const;
+
+    /********************************************************************************
+     * @brief Greater than or equal operator.
+     *
+     * @param other Reference to the number to compare with.
+     *
+     * @return True if the number is greater than or equal to the other number,
+     *         else false.
+     ********************************************************************************/
+    constexpr bool operator>=(const Fixed& other) const;
+
+private:
+    using Wide = typename type_traits::conditional<(TotalBits <= 8U), int16_t,
+        typename type_traits::conditional<(TotalBits <= 16U), int32_t, int64_t>::type>::type;
+
+    static constexpr Wide MaxRaw{(static_cast<Wide>(1) << (IntBits + FracBits)) - 1};
+    static constexpr Wide MinRaw{-MaxRaw - 1};
+    static constexpr Wide One{static_cast<Wide>(1) << FracBits};
+
+    static constexpr Fixed saturate(const Wide value);
+
+    Raw myRaw{};
+};
+
+} // namespace utils
+
+#include "fixed_impl.h"
\ No newline at end of file
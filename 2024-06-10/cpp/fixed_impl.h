@@ -0,0 +1,315 @@
+/********************************************************************************
+ * @brief Implementation details for the utils::Fixed class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace utils
+{
+namespace detail
+{
+
+// -----------------------------------------------------------------------------
+template <uint8_t Shift, typename T>
+constexpr T shiftRound(const T value)
+{
+    if constexpr (Shift == 0U) { return value; }
+    else
+    {
+        constexpr T half{static_cast<T>(1) << (Shift - 1U)};
+        return value >= 0 ? (value + half) >> Shift : -((-value + half) >> Shift);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Shift, typename T>
+constexpr T shiftTruncate(const T value)
+{
+    return value >= 0 ? value >> Shift : -((-value) >> Shift);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Result, typename T>
+constexpr Result clampTo(const T value)
+{
+    if constexpr (type_traits::is_unsigned<Result>::value)
+    {
+        if (value < 0) { return 0; }
+        if constexpr (sizeof(Result) < sizeof(T))
+        {
+            constexpr T max{(static_cast<T>(1) << (8U * sizeof(Result))) - 1};
+            if (value > max) { return static_cast<Result>(max); }
+        }
+    }
+    else if constexpr (sizeof(Result) < sizeof(T))
+    {
+        constexpr T max{(static_cast<T>(1) << (8U * sizeof(Result) - 1U)) - 1};
+        if (value > max) { return static_cast<Result>(max); }
+        if (value < -max - 1) { return static_cast<Result>(-max - 1); }
+    }
+    return static_cast<Result>(value);
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+template <typename T>
+constexpr Fixed<IntBits, FracBits>::Fixed(const T value)
+{
+    static_assert(type_traits::is_arithmetic<T>::value,
+        "Fixed-point numbers can only be created from arithmetic types!");
+
+    if constexpr (type_traits::is_floating_point<T>::value)
+    {
+        const T scaled{value * static_cast<T>(One)};
+        if (scaled >= static_cast<T>(MaxRaw)) { myRaw = static_cast<Raw>(MaxRaw); }
+        else if (scaled <= static_cast<T>(MinRaw)) { myRaw = static_cast<Raw>(MinRaw); }
+        else
+        {
+            const T half{static_cast<T>(0.5)};
+            myRaw = static_cast<Raw>(scaled >= 0 ? scaled + half : scaled - half);
+        }
+    }
+    else
+    {
+        // Only compare against the integer range if T can exceed it.
+        constexpr uint8_t valueBits{8U * sizeof(T) - (type_traits::is_unsigned<T>::value ? 0U : 1U)};
+        if constexpr (valueBits > IntBits)
+        {
+            constexpr T maxInteger{static_cast<T>((static_cast<Wide>(1) << IntBits) - 1)};
+            if (value > maxInteger)
+            {
+                myRaw = static_cast<Raw>(MaxRaw);
+                return;
+            }
+            if constexpr (!type_traits::is_unsigned<T>::value)
+            {
+                if (value < -maxInteger - 1)
+                {
+                    myRaw = static_cast<Raw>(MinRaw);
+                    return;
+                }
+            }
+        }
+        myRaw = static_cast<Raw>(static_cast<Wide>(value) * One);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::fromRaw(const Raw raw)
+{
+    Fixed number{};
+    number.myRaw = raw;
+    return number;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+template <typename T>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::fromRatio(const T numerator,
+                                                                      const T denominator)
+{
+    static_assert(type_traits::is_integral<T>::value,
+        "Fixed-point ratios can only be created from integral types!");
+
+    // The scaled numerator and the rounding term must fit in 31 bits plus sign.
+    using Product = typename type_traits::conditional<(8U * sizeof(T) + FracBits < 31U),
+                                                      int32_t, int64_t>::type;
+    if (denominator == 0) { return numerator >= 0 ? max() : min(); }
+    const Product scaled{static_cast<Product>(numerator) * One};
+    const Product divisor{static_cast<Product>(denominator)};
+    const Product half{divisor / 2};
+
+    // Add half the divisor with the sign of the quotient to round to nearest.
+    const bool positive{(scaled < 0) == (divisor < 0)};
+    const Product quotient{(scaled + (positive ? half : -half)) / divisor};
+    if (quotient > MaxRaw) { return max(); }
+    if (quotient < MinRaw) { return min(); }
+    return fromRaw(static_cast<Raw>(quotient));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::max()
+{
+    return fromRaw(static_cast<Raw>(MaxRaw));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::min()
+{
+    return fromRaw(static_cast<Raw>(MinRaw));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr typename Fixed<IntBits, FracBits>::Raw Fixed<IntBits, FracBits>::raw() const
+{
+    return myRaw;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+template <typename T>
+constexpr T Fixed<IntBits, FracBits>::round() const
+{
+    return detail::clampTo<T>(detail::shiftRound<FracBits>(static_cast<Wide>(myRaw)));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+template <typename T>
+constexpr T Fixed<IntBits, FracBits>::truncate() const
+{
+    return detail::clampTo<T>(detail::shiftTruncate<FracBits>(static_cast<Wide>(myRaw)));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr double Fixed<IntBits, FracBits>::toDouble() const
+{
+    return myRaw / static_cast<double>(One);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+template <typename Result, typename T>
+constexpr Result Fixed<IntBits, FracBits>::scale(const T value) const
+{
+    static_assert(type_traits::is_integral<T>::value && type_traits::is_integral<Result>::value,
+        "Fixed-point numbers can only scale integral types!");
+    using Product = typename type_traits::conditional<(sizeof(T) + sizeof(Raw) <= 4U),
+                                                      int32_t, int64_t>::type;
+    const Product product{static_cast<Product>(value) * myRaw};
+    return detail::clampTo<Result>(detail::shiftRound<FracBits>(product));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::operator+(const Fixed& other) const
+{
+    return saturate(static_cast<Wide>(myRaw) + other.myRaw);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::operator-(const Fixed& other) const
+{
+    return saturate(static_cast<Wide>(myRaw) - other.myRaw);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::operator*(const Fixed& other) const
+{
+    return saturate(detail::shiftRound<FracBits>(static_cast<Wide>(myRaw) * other.myRaw));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::operator/(const Fixed& other) const
+{
+    if (other.myRaw == 0) { return myRaw >= 0 ? max() : min(); }
+    const Wide numerator{static_cast<Wide>(static_cast<Wide>(myRaw) * One)};
+    const Wide half{static_cast<Wide>(other.myRaw / 2)};
+
+    // Add half the divisor with the sign of the quotient to round to nearest.
+    const bool positive{(numerator < 0) == (other.myRaw < 0)};
+    return saturate((numerator + (positive ? half : -half)) / other.myRaw);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::operator-() const
+{
+    return saturate(-static_cast<Wide>(myRaw));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits>& Fixed<IntBits, FracBits>::operator+=(const Fixed& other)
+{
+    *this = *this + other;
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits>& Fixed<IntBits, FracBits>::operator-=(const Fixed& other)
+{
+    *this = *this - other;
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits>& Fixed<IntBits, FracBits>::operator*=(const Fixed& other)
+{
+    *this = *this * other;
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits>& Fixed<IntBits, FracBits>::operator/=(const Fixed& other)
+{
+    *this = *this / other;
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr bool Fixed<IntBits, FracBits>::operator==(const Fixed& other) const
+{
+    return myRaw == other.myRaw;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr bool Fixed<IntBits, FracBits>::operator!=(const Fixed& other) const
+{
+    return myRaw != other.myRaw;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr bool Fixed<IntBits, FracBits>::operator<(const Fixed& other) const
+{
+    return myRaw < other.myRaw;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr bool Fixed<IntBits, FracBits>::operator>(const Fixed& other) const
+{
+    return myRaw > other.myRaw;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr bool Fixed<IntBits, FracBits>::operator<=(const Fixed& other) const
+{
+    return myRaw <= other.myRaw;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr bool Fixed<IntBits, FracBits>::operator>=(const Fixed& other) const
+{
+    return myRaw >= other.myRaw;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::saturate(const Wide value)
+{
+    if (value > MaxRaw) { return max(); }
+    if (value < MinRaw) { return min(); }
+    return fromRaw(static_cast<Raw>(value));
+}
+
+} // namespace utils
\ No newline at end of file
@@ -0,0 +1,119 @@
+/********************************************************************************
+ * @brief Implementation of constant arrays stored in program memory.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+#include "array.h"
+#include "span.h"
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#endif
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of constant arrays stored in program memory.
+ *        The elements are placed in flash at compile time, so the array
+ *        occupies no RAM and isn't copied at startup, which makes it suitable
+ *        for lookup tables such as segment patterns or scaling factors:
+ *
+ *            constexpr container::FlashArray<uint8_t, 4> Segments PROGMEM{
+ *                0x3F, 0x06, 0x5B, 0x4F};
+ *
+ *            const auto pattern{Segments.read(2)};
+ *
+ *        The elements are read via read() or copy(), since program memory
+ *        can't be accessed like RAM on AVR.
+ *
+ * @tparam T    The array type.
+ * @tparam Size The array size.
+ *
+ * @note The array must be declared constexpr and PROGMEM, since it's always
+ *       read from program memory on AVR. The array size must exceed 0, else a
+ *       compilation error will be generated.
+ ********************************************************************************/
+template <typename T, size_t Size>
+class FlashArray
+{
+public:
+    /********************************************************************************
+     * @brief Creates array containing specified values.
+     *
+     * @tparam Values Parameter pack holding values.
+     *
+     * @param values The values to store in the array. Remaining elements are
+     *               set to their default value.
+     *
+     * @note The number of values cannot exceed the array size, else a
+     *       compilation error will be generated.
+     ********************************************************************************/
+    template <typename... Values>
+    constexpr FlashArray(const Values&... values);
+
+    /********************************************************************************
+     * @brief Creates array containing referenced values.
+     *
+     * @param values Reference to values to store in the array.
+     ********************************************************************************/
+    constexpr FlashArray(const T (&values)[Size]);
+
+    /********************************************************************************
+     * @brief Creates array containing the values of referenced array.
+     *
+     * @param source Reference to array holding the values to store.
+     ********************************************************************************/
+    constexpr FlashArray(const Array<T, Size>& source);
+
+    /********************************************************************************
+     * @brief Reads the element at specified index from program memory.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return The element at specified index, or a default value if the index
+     *         is out of range.
+     ********************************************************************************/
+    T read(const size_t index) const;
+
+    /********************************************************************************
+     * @brief Copies elements from program memory to referenced destination.
+     *
+     * @param destination Reference to span viewing the destination.
+     * @param offset      Index of the first element to copy (default = 0).
+     *
+     * @return The number of copied elements, which is limited both by the size
+     *         of the destination and the number of elements after the offset.
+     ********************************************************************************/
+    size_t copy(const Span<T>& destination, const size_t offset = 0) const;
+
+    /********************************************************************************
+     * @brief Returns the size of the array in the number of elements it holds.
+     *
+     * @return The size of the array as an unsigned integer.
+     ********************************************************************************/
+    static constexpr size_t size();
+
+private:
+    static_assert(Size > 0, "Flash array size cannot be set to 0!");
+    T myData[Size]{};
+};
+
+/********************************************************************************
+ * @brief Deduction guides, which make it possible to omit the element type and
+ *        size when creating a flash array from an array.
+ ********************************************************************************/
+template <typename T, size_t Size>
+FlashArray(const T (&)[Size]) -> FlashArray<T, Size>;
+template <typename T, size_t Size>
+FlashArray(const Array<T, Size>&) -> FlashArray<T, Size>;
+
+} // namespace container
+
+#include "flash_array_impl.h"
\ No newline at end of file
@@ -0,0 +1,67 @@
+/********************************************************************************
+ * @brief Implementation details for the container::FlashArray class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+template <typename... Values>
+constexpr FlashArray<T, Size>::FlashArray(const Values&... values)
+    : myData{static_cast<T>(values)...}
+{
+    static_assert(sizeof...(Values) <= Size, "Too many values for flash array!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+constexpr FlashArray<T, Size>::FlashArray(const T (&values)[Size])
+{
+    for (size_t i{}; i < Size; ++i) { myData[i] = values[i]; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+constexpr FlashArray<T, Size>::FlashArray(const Array<T, Size>& source)
+{
+    for (size_t i{}; i < Size; ++i) { myData[i] = source[i]; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+T FlashArray<T, Size>::read(const size_t index) const
+{
+    if (index >= Size) { return T{}; }
+#ifdef __AVR__
+    T value{};
+    memcpy_P(&value, &myData[index], sizeof(T));
+    return value;
+#else
+    return myData[index];
+#endif
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+size_t FlashArray<T, Size>::copy(const Span<T>& destination, const size_t offset) const
+{
+    if (offset >= Size) { return 0; }
+    const auto remaining{Size - offset};
+    const auto count{destination.size() < remaining ? destination.size() : remaining};
+#ifdef __AVR__
+    memcpy_P(destination.data(), &myData[offset], count * sizeof(T));
+#else
+    memcpy(destination.data(), &myData[offset], count * sizeof(T));
+#endif
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+constexpr size_t FlashArray<T, Size>::size() { return Size; }
+
+} // namespace container
\ No newline at end of file
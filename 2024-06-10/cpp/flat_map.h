@@ -0,0 +1,291 @@
+/********************************************************************************
+ * @brief Implementation of fixed-capacity hash maps of any key and value type.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hash.h"
+#include "pair.h"
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of fixed-capacity hash maps. The entries are
+ *        stored inline via open addressing with linear probing, so the map
+ *        never allocates heap memory. Removed entries are closed up by
+ *        shifting subsequent entries backwards, so no tombstones are left
+ *        and lookups never slow down because of earlier removals.
+ *
+ * @tparam K        The key type.
+ * @tparam V        The value type.
+ * @tparam Capacity The maximum number of entries the map can hold.
+ * @tparam KeyHash  Structure used for hashing and comparing keys, see hash.h
+ *                  (default = container::Hash<K>).
+ *
+ * @note The capacity must be a power of two of at least 2, else a compilation
+ *       error will be generated. Lookups are fastest when at most about three
+ *       quarters of the capacity is used.
+ ********************************************************************************/
+template <typename K, typename V, size_t Capacity, typename KeyHash = Hash<K>>
+class FlatMap
+{
+public:
+    class Iterator;
+    class ConstIterator;
+
+    /********************************************************************************
+     * @brief Creates empty map.
+     ********************************************************************************/
+    FlatMap();
+
+    /********************************************************************************
+     * @brief Deletes map.
+     ********************************************************************************/
+    ~FlatMap();
+
+    /********************************************************************************
+     * @brief Inserts specified key and value. If the key is already present,
+     *        its value is updated.
+     *
+     * @param key   Reference to the key.
+     * @param value Reference to the value.
+     *
+     * @return True if the value was stored, false if the map is full.
+     ********************************************************************************/
+    bool insert(const K& key, const V& value);
+
+    /********************************************************************************
+     * @brief Finds the value stored for specified key.
+     *
+     * @param key Reference to the key to search for.
+     *
+     * @return A pointer to the value, or a null pointer if the key isn't present.
+     ********************************************************************************/
+    V* find(const K& key);
+
+    /********************************************************************************
+     * @brief Finds the value stored for specified key.
+     *
+     * @param key Reference to the key to search for.
+     *
+     * @return A pointer to the value, or a null pointer if the key isn't present.
+     ********************************************************************************/
+    const V* find(const K& key) const;
+
+    /********************************************************************************
+     * @brief Indicates if specified key is present in the map.
+     *
+     * @param key Reference to the key to search for.
+     *
+     * @return True if the key is present, else false.
+     ********************************************************************************/
+    bool contains(const K& key) const;
+
+    /********************************************************************************
+     * @brief Removes specified key and its value from the map.
+     *
+     * @param key Reference to the key to remove.
+     *
+     * @return True if the key was removed, false if it wasn't present.
+     ********************************************************************************/
+    bool remove(const K& key);
+
+    /********************************************************************************
+     * @brief Removes all entries from the map.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Returns the number of entries stored in the map.
+     *
+     * @return The number of entries as an unsigned integer.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Returns the capacity of the map.
+     *
+     * @return The maximum number of entries the map can hold.
+     ********************************************************************************/
+    static constexpr size_t capacity();
+
+    /********************************************************************************
+     * @brief Indicates if the map is empty.
+     *
+     * @return True if the map is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Indicates if the map is full.
+     *
+     * @return True if the map is full, else false.
+     ********************************************************************************/
+    bool full() const;
+
+    /********************************************************************************
+     * @brief Provides iterator pointing at the first entry of the map. The
+     *        entries are visited in storage order, not insertion order.
+     *
+     * @return Iterator pointing at the first entry of the map.
+     ********************************************************************************/
+    Iterator begin();
+
+    /********************************************************************************
+     * @brief Provides iterator pointing at the first entry of the map.
+     *
+     * @return Iterator pointing at the first entry of the map.
+     ********************************************************************************/
+    ConstIterator begin() const;
+
+    /********************************************************************************
+     * @brief Provides iterator pointing at the end of the map.
+     *
+     * @return Iterator pointing at the end of the map.
+     ********************************************************************************/
+    Iterator end();
+
+    /********************************************************************************
+     * @brief Provides iterator pointing at the end of the map.
+     *
+     * @return Iterator pointing at the end of the map.
+     ********************************************************************************/
+    ConstIterator end() const;
+
+private:
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+        "Flat map capacity must be a power of two of at least 2!");
+    static constexpr size_t IndexMask{Capacity - 1};
+
+    static size_t home(const K& key);
+    size_t indexOf(const K& key) const;
+    size_t nextOccupied(size_t index) const;
+    bool occupied(const size_t index) const;
+    void setOccupied(const size_t index, const bool occupied);
+
+    Pair<K, V> myEntries[Capacity]{};
+    uint8_t myOccupied[(Capacity + 7) / 8]{};
+    size_t mySize{};
+};
+
+/********************************************************************************
+ * @brief Implementation of mutable flat map iterators.
+ *
+ * @note The key of an entry must not be modified via the iterator.
+ ********************************************************************************/
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+class FlatMap<K, V, Capacity, KeyHash>::Iterator
+{
+public:
+    /********************************************************************************
+     * @brief Creates iterator pointing at specified entry of referenced map.
+     *
+     * @param map   Reference to the map.
+     * @param index Index of the entry (advanced to the next occupied entry).
+     ********************************************************************************/
+    Iterator(FlatMap& map, const size_t index);
+
+    /********************************************************************************
+     * @brief Advances the iterator to the next entry (prefix operator).
+     ********************************************************************************/
+    void operator++();
+
+    /********************************************************************************
+     * @brief Advances the iterator to the next entry (postfix operator).
+     ********************************************************************************/
+    void operator++(int);
+
+    /********************************************************************************
+     * @brief Indicates if the iterator and referenced other iterator point at the
+     *        same entry.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same entry, else false.
+     ********************************************************************************/
+    bool operator==(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Indicates if the iterator and referenced other iterator point at
+     *        different entries.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at different entries, else false.
+     ********************************************************************************/
+    bool operator!=(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Provides the entry the iterator is pointing at.
+     *
+     * @return Reference to the entry, where first is the key and second the value.
+     ********************************************************************************/
+    Pair<K, V>& operator*();
+
+private:
+    FlatMap* myMap;
+    size_t myIndex;
+};
+
+/********************************************************************************
+ * @brief Implementation of constant flat map iterators.
+ ********************************************************************************/
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+class FlatMap<K, V, Capacity, KeyHash>::ConstIterator
+{
+public:
+    /********************************************************************************
+     * @brief Creates iterator pointing at specified entry of referenced map.
+     *
+     * @param map   Reference to the map.
+     * @param index Index of the entry (advanced to the next occupied entry).
+     ********************************************************************************/
+    ConstIterator(const FlatMap& map, const size_t index);
+
+    /********************************************************************************
+     * @brief Advances the iterator to the next entry (prefix operator).
+     ********************************************************************************/
+    void operator++();
+
+    /********************************************************************************
+     * @brief Advances the iterator to the next entry (postfix operator).
+     ********************************************************************************/
+    void operator++(int);
+
+    /********************************************************************************
+     * @brief Indicates if the iterator and referenced other iterator point at the
+     *        same entry.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same entry, else false.
+     ********************************************************************************/
+    bool operator==(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Indicates if the iterator and referenced other iterator point at
+     *        different entries.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at different entries, else false.
+     ********************************************************************************/
+    bool operator!=(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Provides the entry the iterator is pointing at.
+     *
+     * @return Reference to the entry, where first is the key and second the value.
+     ********************************************************************************/
+    const Pair<K, V>& operator*() const;
+
+private:
+    const FlatMap* myMap;
+    size_t myIndex;
+};
+
+} // namespace container
+
+#include "flat_map_impl.h"
\ No newline at end of file
@@ -0,0 +1,278 @@
+/********************************************************************************
+ * @brief Implementation details for the container::FlatMap class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+#include "utils.h"
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+FlatMap<K, V, Capacity, KeyHash>::FlatMap() = default;
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+FlatMap<K, V, Capacity, KeyHash>::~FlatMap() = default;
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::insert(const K& key, const V& value)
+{
+    auto index{home(key)};
+    for (size_t i{}; i < Capacity; ++i, index = (index + 1) & IndexMask)
+    {
+        if (!occupied(index))
+        {
+            if (mySize == Capacity) { return false; }
+            myEntries[index].first = key;
+            myEntries[index].second = value;
+            setOccupied(index, true);
+            mySize++;
+            return true;
+        }
+        if (KeyHash::equal(myEntries[index].first, key))
+        {
+            myEntries[index].second = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+V* FlatMap<K, V, Capacity, KeyHash>::find(const K& key)
+{
+    const auto index{indexOf(key)};
+    return index < Capacity ? &myEntries[index].second : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+const V* FlatMap<K, V, Capacity, KeyHash>::find(const K& key) const
+{
+    const auto index{indexOf(key)};
+    return index < Capacity ? &myEntries[index].second : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::contains(const K& key) const
+{
+    return indexOf(key) < Capacity;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::remove(const K& key)
+{
+    auto index{indexOf(key)};
+    if (index == Capacity) { return false; }
+
+    // Shift subsequent entries of the probe sequence backwards into the gap,
+    // unless the gap lies before their home slot.
+    auto next{(index + 1) & IndexMask};
+    for (size_t i{1}; i < Capacity && occupied(next); ++i, next = (next + 1) & IndexMask)
+    {
+        const auto nextHome{home(myEntries[next].first)};
+        if (((next - nextHome) & IndexMask) >= ((next - index) & IndexMask))
+        {
+            myEntries[index] = utils::move(myEntries[next]);
+            index = next;
+        }
+    }
+
+    myEntries[index] = Pair<K, V>{};
+    setOccupied(index, false);
+    mySize--;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+void FlatMap<K, V, Capacity, KeyHash>::clear()
+{
+    for (size_t i{}; i < Capacity; ++i)
+    {
+        if (occupied(i)) { myEntries[i] = Pair<K, V>{}; }
+    }
+    for (auto& byte : myOccupied) { byte = 0; }
+    mySize = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+size_t FlatMap<K, V, Capacity, KeyHash>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+constexpr size_t FlatMap<K, V, Capacity, KeyHash>::capacity() { return Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::full() const { return mySize == Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+typename FlatMap<K, V, Capacity, KeyHash>::Iterator FlatMap<K, V, Capacity, KeyHash>::begin()
+{
+    return Iterator{*this, 0};
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+typename FlatMap<K, V, Capacity, KeyHash>::ConstIterator 
+FlatMap<K, V, Capacity, KeyHash>::begin() const
+{
+    return ConstIterator{*this, 0};
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+typename FlatMap<K, V, Capacity, KeyHash>::Iterator FlatMap<K, V, Capacity, KeyHash>::end()
+{
+    return Iterator{*this, Capacity};
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+typename FlatMap<K, V, Capacity, KeyHash>::ConstIterator 
+FlatMap<K, V, Capacity, KeyHash>::end() const
+{
+    return ConstIterator{*this, Capacity};
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+size_t FlatMap<K, V, Capacity, KeyHash>::home(const K& key)
+{
+    return KeyHash::hash(key) & IndexMask;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+size_t FlatMap<K, V, Capacity, KeyHash>::indexOf(const K& key) const
+{
+    auto index{home(key)};
+    for (size_t i{}; i < Capacity && occupied(index); ++i, index = (index + 1) & IndexMask)
+    {
+        if (KeyHash::equal(myEntries[index].first, key)) { return index; }
+    }
+    return Capacity;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+size_t FlatMap<K, V, Capacity, KeyHash>::nextOccupied(size_t index) const
+{
+    while (index < Capacity && !occupied(index)) { index++; }
+    return index;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::occupied(const size_t index) const
+{
+    return myOccupied[index / 8] & (1 << (index % 8));
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+void FlatMap<K, V, Capacity, KeyHash>::setOccupied(const size_t index, const bool occupied)
+{
+    if (occupied) { myOccupied[index / 8] |= (1 << (index % 8)); }
+    else { myOccupied[index / 8] &= ~(1 << (index % 8)); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+FlatMap<K, V, Capacity, KeyHash>::Iterator::Iterator(FlatMap& map, const size_t index)
+    : myMap{&map}
+    , myIndex{map.nextOccupied(index)} {}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+void FlatMap<K, V, Capacity, KeyHash>::Iterator::operator++()
+{
+    myIndex = myMap->nextOccupied(myIndex + 1);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+void FlatMap<K, V, Capacity, KeyHash>::Iterator::operator++(int)
+{
+    myIndex = myMap->nextOccupied(myIndex + 1);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::Iterator::operator==(const Iterator& other) const
+{
+    return myMap == other.myMap && myIndex == other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::Iterator::operator!=(const Iterator& other) const
+{
+    return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+Pair<K, V>& FlatMap<K, V, Capacity, KeyHash>::Iterator::operator*()
+{
+    return myMap->myEntries[myIndex];
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+FlatMap<K, V, Capacity, KeyHash>::ConstIterator::ConstIterator(const FlatMap& map, 
+                                                              const size_t index)
+    : myMap{&map}
+    , myIndex{map.nextOccupied(index)} {}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+void FlatMap<K, V, Capacity, KeyHash>::ConstIterator::operator++()
+{
+    myIndex = myMap->nextOccupied(myIndex + 1);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+void FlatMap<K, V, Capacity, KeyHash>::ConstIterator::operator++(int)
+{
+    myIndex = myMap->nextOccupied(myIndex + 1);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::ConstIterator::operator==(const ConstIterator& other) const
+{
+    return myMap == other.myMap && myIndex == other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+bool FlatMap<K, V, Capacity, KeyHash>::ConstIterator::operator!=(const ConstIterator& other) const
+{
+    return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t Capacity, typename KeyHash>
+const Pair<K, V>& FlatMap<K, V, Capacity, KeyHash>::ConstIterator::operator*() const
+{
+    return myMap->myEntries[myIndex];
+}
+
+} // namespace container
\ No newline at end of file
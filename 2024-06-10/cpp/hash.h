@@ -0,0 +1,74 @@
+/********************************************************************************
+ * @brief Hash functions for keys of hashed containers.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace container
+{
+
+/********************************************************************************
+ * @brief Structure providing hashing and comparison of keys of integral or
+ *        enumeration type. Integers are folded so that all bits affect the
+ *        low bits of the hash, while small keys (such as pin numbers) map
+ *        to themselves.
+ *
+ * @tparam K The key type.
+ *
+ * @note Specialize this structure to use other key types.
+ ********************************************************************************/
+template <typename K>
+struct Hash
+{
+    /********************************************************************************
+     * @brief Computes the hash of specified key.
+     *
+     * @param key Reference to the key to hash.
+     *
+     * @return The hash of the key.
+     ********************************************************************************/
+    static constexpr size_t hash(const K& key);
+
+    /********************************************************************************
+     * @brief Indicates if specified keys are equal.
+     *
+     * @param a Reference to the first key.
+     * @param b Reference to the second key.
+     *
+     * @return True if the keys are equal, else false.
+     ********************************************************************************/
+    static constexpr bool equal(const K& a, const K& b);
+};
+
+/********************************************************************************
+ * @brief Structure providing hashing and comparison of null-terminated string
+ *        keys via FNV-1a. The strings are compared by content, not address.
+ ********************************************************************************/
+template <>
+struct Hash<const char*>
+{
+    /********************************************************************************
+     * @brief Computes the hash of specified string.
+     *
+     * @param key The string to hash.
+     *
+     * @return The hash of the string.
+     ********************************************************************************/
+    static constexpr size_t hash(const char* key);
+
+    /********************************************************************************
+     * @brief Indicates if specified strings are equal.
+     *
+     * @param a The first string.
+     * @param b The second string.
+     *
+     * @return True if the strings are equal, else false.
+     ********************************************************************************/
+    static constexpr bool equal(const char* a, const char* b);
+};
+
+} // namespace container
+
+#include "hash_impl.h"
\ No newline at end of file
@@ -0,0 +1,51 @@
+/********************************************************************************
+ * @brief Implementation details for the container::Hash structures.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename K>
+constexpr size_t Hash<K>::hash(const K& key)
+{
+    if constexpr (sizeof(K) > sizeof(uint32_t))
+    {
+        const auto value{static_cast<uint64_t>(key)};
+        const auto folded{static_cast<uint32_t>(value ^ (value >> 32))};
+        return static_cast<size_t>(folded ^ (folded >> 16));
+    }
+    else
+    {
+        const auto value{static_cast<uint32_t>(key)};
+        return static_cast<size_t>(value ^ (value >> 16));
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename K>
+constexpr bool Hash<K>::equal(const K& a, const K& b) { return a == b; }
+
+// -----------------------------------------------------------------------------
+constexpr size_t Hash<const char*>::hash(const char* key)
+{
+    uint32_t hash{2166136261UL};
+    for (; *key; ++key)
+    {
+        hash ^= static_cast<uint8_t>(*key);
+        hash *= 16777619UL;
+    }
+    return static_cast<size_t>(hash ^ (hash >> 16));
+}
+
+// -----------------------------------------------------------------------------
+constexpr bool Hash<const char*>::equal(const char* a, const char* b)
+{
+    for (; *a && *a == *b; ++a, ++b);
+    return *a == *b;
+}
+
+} // namespace container
\ No newline at end of file
@@ -0,0 +1,385 @@
+/********************************************************************************
+ * @brief Implementation of intrusive doubly linked lists, which chain existing
+ *        objects without allocating any memory.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+
+namespace container
+{
+/********************************************************************************
+ * @brief Hook to embed in objects that are to be stored in an intrusive list.
+ *        An object can be stored in one list per hook it contains.
+ *
+ * @tparam T The type of the object containing the hook.
+ ********************************************************************************/
+template <typename T>
+struct IntrusiveHook
+{
+    T* previous{nullptr};      // Previous object in the list.
+    T* next{nullptr};          // Next object in the list.
+    const void* list{nullptr}; // The list storing the object, nullptr if unlinked.
+};
+
+/********************************************************************************
+ * @brief Class for implementation of intrusive doubly linked lists. The list
+ *        stores references to existing objects via a hook embedded in each
+ *        object, hence no memory is allocated or copied:
+ *
+ *            struct Job { container::IntrusiveHook<Job> hook; };
+ *            container::IntrusiveList<Job, &Job::hook> jobs{};
+ *
+ * @tparam T    The type of the objects stored in the list.
+ * @tparam Hook Pointer to the hook member used for linking the objects.
+ *
+ * @note The stored objects must outlive the list or be removed from it before
+ *       they are deleted.
+ ********************************************************************************/
+template <typename T, IntrusiveHook<T> T::*Hook>
+class IntrusiveList
+{
+public:
+    class Iterator;
+    class ConstIterator;
+
+    /********************************************************************************
+     * @brief Creates empty list.
+     ********************************************************************************/
+    IntrusiveList();
+
+    /********************************************************************************
+     * @brief Unlinks all stored objects before deletion.
+     ********************************************************************************/
+    ~IntrusiveList();
+
+    /********************************************************************************
+     * @brief Copy constructor deleted.
+     ********************************************************************************/
+    IntrusiveList(IntrusiveList&) = delete;
+
+    /********************************************************************************
+     * @brief Assignment operator deleted.
+     ********************************************************************************/
+    IntrusiveList& operator=(IntrusiveList&) = delete;
+
+    /********************************************************************************
+     * @brief Move constructor deleted.
+     ********************************************************************************/
+    IntrusiveList(IntrusiveList&&) = delete;
+
+    /********************************************************************************
+     * @brief Returns the size of the list.
+     *
+     * @return The size of the list in the number of objects it holds.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Indicates if the list is empty.
+     *
+     * @return True if the list is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Unlinks all objects stored in the list.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Provides the start address of the list.
+     *
+     * @return Iterator pointing at the start address of the list.
+     ********************************************************************************/
+    Iterator begin();
+
+    /********************************************************************************
+     * @brief Provides the start address of the list.
+     *
+     * @return Iterator pointing at the start address of the list.
+     ********************************************************************************/
+    ConstIterator begin() const;
+
+    /********************************************************************************
+     * @brief Provides the end address of the list.
+     *
+     * @return Iterator pointing at the end address of the list.
+     ********************************************************************************/
+    Iterator end();
+
+    /********************************************************************************
+     * @brief Provides the end address of the list.
+     *
+     * @return Iterator pointing at the end address of the list.
+     ********************************************************************************/
+    ConstIterator end() const;
+
+    /********************************************************************************
+     * @brief Provides the reverse start address of the list.
+     *
+     * @return Iterator pointing at the reverse start address of the list.
+     ********************************************************************************/
+    Iterator rbegin();
+
+    /********************************************************************************
+     * @brief Provides the reverse start address of the list.
+     *
+     * @return Iterator pointing at the reverse start address of the list.
+     ********************************************************************************/
+    ConstIterator rbegin() const;
+
+    /********************************************************************************
+     * @brief Provides the reverse end address of the list.
+     *
+     * @return Iterator pointing at the reverse end address of the list.
+     ********************************************************************************/
+    Iterator rend();
+
+    /********************************************************************************
+     * @brief Provides the reverse end address of the list.
+     *
+     * @return Iterator pointing at the reverse end address of the list.
+     ********************************************************************************/
+    ConstIterator rend() const;
+
+    /********************************************************************************
+     * @brief Links referenced object at the front of the list.
+     *
+     * @param object Reference to the object to link.
+     *
+     * @return True if the object was linked, false if it's already linked.
+     ********************************************************************************/
+    bool pushFront(T& object);
+
+    /********************************************************************************
+     * @brief Links referenced object at the back of the list.
+     *
+     * @param object Reference to the object to link.
+     *
+     * @return True if the object was linked, false if it's already linked.
+     ********************************************************************************/
+    bool pushBack(T& object);
+
+    /********************************************************************************
+     * @brief Links referenced object at specified position in the list.
+     *
+     * @param iterator Reference to iterator pointing at the location to place
+     *                 the object.
+     * @param object   Reference to the object to link.
+     *
+     * @return True if the object was linked, false if it's already linked or
+     *         if the iterator points at an object of another list.
+     ********************************************************************************/
+    bool insert(Iterator& iterator, T& object);
+
+    /********************************************************************************
+     * @brief Unlinks the object at the front of the list.
+     ********************************************************************************/
+    void popFront();
+
+    /********************************************************************************
+     * @brief Unlinks the object at the back of the list.
+     ********************************************************************************/
+    void popBack();
+
+    /********************************************************************************
+     * @brief Unlinks the object at specified position in the list.
+     *
+     * @param iterator Reference to iterator pointing at the object to unlink.
+     *
+     * @return True if the object was unlinked, else false.
+     ********************************************************************************/
+    bool remove(Iterator& iterator);
+
+    /********************************************************************************
+     * @brief Unlinks referenced object from the list in constant time.
+     *
+     * @param object Reference to the object to unlink.
+     *
+     * @return True if the object was unlinked, false if it isn't stored in
+     *         this list.
+     ********************************************************************************/
+    bool remove(T& object);
+
+private:
+    static IntrusiveHook<T>& hook(T& object);
+    static const IntrusiveHook<T>& hook(const T& object);
+
+    T* myFirst{nullptr};
+    T* myLast{nullptr};
+    size_t mySize{};
+};
+
+/********************************************************************************
+ * @brief Implementation of mutable intrusive list iterators.
+ *
+ * @tparam T    The type of the objects stored in the list.
+ * @tparam Hook Pointer to the hook member used for linking the objects.
+ ********************************************************************************/
+template <typename T, IntrusiveHook<T> T::*Hook>
+class IntrusiveList<T, Hook>::Iterator
+{
+public:
+    /********************************************************************************
+     * @brief Creates empty iterator.
+     ********************************************************************************/
+    Iterator();
+
+    /********************************************************************************
+     * @brief Creates iterator pointing at referenced object.
+     *
+     * @param object Pointer to the object the iterator is to point at.
+     ********************************************************************************/
+    Iterator(T* object);
+
+    /********************************************************************************
+     * @brief Prefix increment operator, sets the iterator to point at next object.
+     ********************************************************************************/
+    void operator++();
+
+    /********************************************************************************
+     * @brief Postfix increment operator, sets the iterator to point at next object.
+     ********************************************************************************/
+    void operator++(int);
+
+    /********************************************************************************
+     * @brief Prefix decrement operator, sets the iterator to point at previous
+     *        object.
+     ********************************************************************************/
+    void operator--();
+
+    /********************************************************************************
+     * @brief Postfix decrement operator, sets the iterator to point at previous
+     *        object.
+     ********************************************************************************/
+    void operator--(int);
+
+    /********************************************************************************
+     * @brief Addition operator, increments the iterator specified number of times.
+     *
+     * @param numIncrements The number of times the iterator will be incremented.
+     ********************************************************************************/
+    void operator+=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Subtraction operator, decrements the iterator specified number of
+     *        times.
+     *
+     * @param numIncrements The number of times the iterator will be decremented.
+     ********************************************************************************/
+    void operator-=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Equality operator, checks if the iterator points at the same object
+     *        as referenced other iterator.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same object, else false.
+     ********************************************************************************/
+    bool operator==(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Inequality operator, checks if the iterator and referenced other
+     *        iterator points at different objects.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at different objects, else false.
+     ********************************************************************************/
+    bool operator!=(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Dereference operator, provides a reference to the object the
+     *        iterator is pointing at.
+     *
+     * @return Reference to the object the iterator is pointing at.
+     ********************************************************************************/
+    T& operator*();
+
+    /********************************************************************************
+     * @brief Returns the address of the object the iterator points at.
+     *
+     * @return Pointer to the object the iterator is pointing at.
+     ********************************************************************************/
+    T* address();
+
+private:
+    T* myObject{nullptr};
+};
+
+/********************************************************************************
+ * @brief Implementation of constant intrusive list iterators.
+ *
+ * @tparam T    The type of the objects stored in the list.
+ * @tparam Hook Pointer to the hook member used for linking the objects.
+ ********************************************************************************/
+template <typename T, IntrusiveHook<T> T::*Hook>
+class IntrusiveList<T, Hook>::ConstIterator
+{
+public:
+    /********************************************************************************
+     * @brief Creates iterator pointing at referenced object.
+     *
+     * @param object Pointer to the object the iterator is to point at.
+     ********************************************************************************/
+    ConstIterator(const T* object);
+
+    /********************************************************************************
+     * @brief Prefix increment operator, sets the iterator to point at next object.
+     ********************************************************************************/
+    void operator++();
+
+    /********************************************************************************
+     * @brief Postfix increment operator, sets the iterator to point at next object.
+     ********************************************************************************/
+    void operator++(int);
+
+    /********************************************************************************
+     * @brief Prefix decrement operator, sets the iterator to point at previous
+     *        object.
+     ********************************************************************************/
+    void operator--();
+
+    /********************************************************************************
+     * @brief Postfix decrement operator, sets the iterator to point at previous
+     *        object.
+     ********************************************************************************/
+    void operator--(int);
+
+    /********************************************************************************
+     * @brief Equality operator, checks if the iterator points at the same object
+     *        as referenced other iterator.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same object, else false.
+     ********************************************************************************/
+    bool operator==(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Inequality operator, checks if the iterator and referenced other
+     *        iterator points at different objects.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at different objects, else false.
+     ********************************************************************************/
+    bool operator!=(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Dereference operator, provides a reference to the object the
+     *        iterator is pointing at.
+     *
+     * @return Reference to the object the iterator is pointing at.
+     ********************************************************************************/
+    const T& operator*() const;
+
+private:
+    const T* myObject{nullptr};
+};
+
+} // namespace container
+
+#include "intrusive_list_impl.h"
\ No newline at end of file
@@ -0,0 +1,310 @@
+/********************************************************************************
+ * @brief Implementation details for the container::IntrusiveList class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveList<T, Hook>::IntrusiveList() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveList<T, Hook>::~IntrusiveList() { clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+size_t IntrusiveList<T, Hook>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::clear()
+{
+    while (myFirst != nullptr)
+    {
+        auto next{hook(*myFirst).next};
+        hook(*myFirst) = {};
+        myFirst = next;
+    }
+    myLast = nullptr;
+    mySize = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::Iterator IntrusiveList<T, Hook>::begin()
+{
+    return Iterator{myFirst};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::ConstIterator IntrusiveList<T, Hook>::begin() const
+{
+    return ConstIterator{myFirst};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::Iterator IntrusiveList<T, Hook>::end()
+{
+    return Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::ConstIterator IntrusiveList<T, Hook>::end() const
+{
+    return ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::Iterator IntrusiveList<T, Hook>::rbegin()
+{
+    return Iterator{myLast};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::ConstIterator IntrusiveList<T, Hook>::rbegin() const
+{
+    return ConstIterator{myLast};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::Iterator IntrusiveList<T, Hook>::rend()
+{
+    return Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::ConstIterator IntrusiveList<T, Hook>::rend() const
+{
+    return ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::pushFront(T& object)
+{
+    if (hook(object).list != nullptr) { return false; }
+    hook(object).previous = nullptr;
+    hook(object).next = myFirst;
+    hook(object).list = this;
+
+    if (myFirst != nullptr) { hook(*myFirst).previous = &object; }
+    else { myLast = &object; }
+    myFirst = &object;
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::pushBack(T& object)
+{
+    if (hook(object).list != nullptr) { return false; }
+    hook(object).previous = myLast;
+    hook(object).next = nullptr;
+    hook(object).list = this;
+
+    if (myLast != nullptr) { hook(*myLast).next = &object; }
+    else { myFirst = &object; }
+    myLast = &object;
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::insert(Iterator& iterator, T& object)
+{
+    auto next{iterator.address()};
+    if (next == nullptr) { return pushBack(object); }
+    if (hook(*next).list != this) { return false; }
+    if (next == myFirst) { return pushFront(object); }
+    if (hook(object).list != nullptr) { return false; }
+
+    auto previous{hook(*next).previous};
+    hook(object).previous = previous;
+    hook(object).next = next;
+    hook(object).list = this;
+    hook(*previous).next = &object;
+    hook(*next).previous = &object;
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::popFront()
+{
+    if (myFirst != nullptr) { remove(*myFirst); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::popBack()
+{
+    if (myLast != nullptr) { remove(*myLast); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::remove(Iterator& iterator)
+{
+    auto object{iterator.address()};
+    return object != nullptr ? remove(*object) : false;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::remove(T& object)
+{
+    if (hook(object).list != this) { return false; }
+    auto previous{hook(object).previous};
+    auto next{hook(object).next};
+
+    if (previous != nullptr) { hook(*previous).next = next; }
+    else { myFirst = next; }
+    if (next != nullptr) { hook(*next).previous = previous; }
+    else { myLast = previous; }
+
+    hook(object) = {};
+    mySize--;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveHook<T>& IntrusiveList<T, Hook>::hook(T& object) { return object.*Hook; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+const IntrusiveHook<T>& IntrusiveList<T, Hook>::hook(const T& object)
+{
+    return object.*Hook;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveList<T, Hook>::Iterator::Iterator() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveList<T, Hook>::Iterator::Iterator(T* object) : myObject{object} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::Iterator::operator++() { myObject = hook(*myObject).next; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::Iterator::operator++(int) { myObject = hook(*myObject).next; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::Iterator::operator--() { myObject = hook(*myObject).previous; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::Iterator::operator--(int) { myObject = hook(*myObject).previous; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::Iterator::operator+=(const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i)
+    {
+        myObject = hook(*myObject).next;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::Iterator::operator-=(const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i)
+    {
+        myObject = hook(*myObject).previous;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::Iterator::operator==(const Iterator& other) const
+{
+    return myObject == other.myObject;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::Iterator::operator!=(const Iterator& other) const
+{
+    return myObject != other.myObject;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+T& IntrusiveList<T, Hook>::Iterator::operator*() { return *myObject; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveList<T, Hook>::Iterator::address() { return myObject; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveList<T, Hook>::ConstIterator::ConstIterator(const T* object) : myObject{object} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::ConstIterator::operator++() { myObject = hook(*myObject).next; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::ConstIterator::operator++(int) { myObject = hook(*myObject).next; }
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::ConstIterator::operator--()
+{
+    myObject = hook(*myObject).previous;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::ConstIterator::operator--(int)
+{
+    myObject = hook(*myObject).previous;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::ConstIterator::operator==(const ConstIterator& other) const
+{
+    return myObject == other.myObject;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::ConstIterator::operator!=(const ConstIterator& other) const
+{
+    return myObject != other.myObject;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, IntrusiveHook<T> T::*Hook>
+const T& IntrusiveList<T, Hook>::ConstIterator::operator*() const { return *myObject; }
+
+} // namespace container
\ No newline at end of file
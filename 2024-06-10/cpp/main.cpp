@@ -19,7 +19,7 @@
  *                            connected to PIN 9 (PORTB1).
  ******************************************************************************/
 #include "gpio.h"
-#include "timer.h"
+#include "static_timer.h"
 #include "watchdog.h"
 
 using namespace driver;
@@ -48,8 +48,8 @@ GPIO nextButton{13U, GPIO::Direction::InputPullup};
  *               for 300 ms after pressdown to reduce effects of contact bounces.
  * @param timer1 Timer used to toggle the LED.
  ********************************************************************************/
-Timer timer0{Timer::Circuit::Timer0, 300U};
-Timer timer1{Timer::Circuit::Timer1, 100U};
+StaticTimer<Timer::Circuit::Timer0, 300U> timer0{};
+StaticTimer<Timer::Circuit::Timer1, 100U> timer1{};
 
 /*******************************************************************************
  * @brief Variable holding the current state of the FSM.
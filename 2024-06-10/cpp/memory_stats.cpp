@@ -0,0 +1,201 @@
+/********************************************************************************
+ * @brief Implementation details for the heap allocation instrumentation.
+ ********************************************************************************/
+#ifdef UTILS_MEMORY_STATS
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "memory_stats.h"
+
+#ifdef __AVR__
+extern "C"
+{
+extern char* __brkval;
+extern char __heap_start;
+extern void* __flp;
+extern size_t __malloc_margin;
+}
+#endif
+
+namespace utils
+{
+namespace memory_stats
+{
+namespace
+{
+
+constexpr uint8_t UnknownCallSite{0xFF};
+
+/********************************************************************************
+ * @brief Header placed in front of each allocated block. The header is
+ *        aligned like the allocated block so that the data is still suitably
+ *        aligned for any type.
+ ********************************************************************************/
+struct alignas(__BIGGEST_ALIGNMENT__) BlockHeader
+{
+    size_t size;
+    uint8_t callSite;
+};
+
+#ifdef __AVR__
+/********************************************************************************
+ * @brief Layout of the entries of the avr-libc free list.
+ ********************************************************************************/
+struct FreeBlock
+{
+    size_t size;
+    FreeBlock* next;
+};
+#endif
+
+Snapshot stats{};
+
+// -----------------------------------------------------------------------------
+uint8_t callSiteIndex(const char* file, const uint16_t line)
+{
+    for (uint8_t i{}; i < stats.numCallSites; ++i)
+    {
+        const auto& site{stats.callSites[i]};
+        if (site.line == line && (site.file == file || strcmp(site.file, file) == 0))
+        {
+            return i;
+        }
+    }
+    if (stats.numCallSites == MaxCallSites) { return UnknownCallSite; }
+    stats.callSites[stats.numCallSites] = CallSite{file, line, 0, 0, 0, 0};
+    return stats.numCallSites++;
+}
+
+// -----------------------------------------------------------------------------
+void addBytes(const uint8_t callSite, const size_t size)
+{
+    stats.liveBytes += size;
+    if (stats.liveBytes > stats.peakBytes) { stats.peakBytes = stats.liveBytes; }
+
+    if (callSite != UnknownCallSite)
+    {
+        auto& site{stats.callSites[callSite]};
+        site.liveBytes += size;
+        if (site.liveBytes > site.peakBytes) { site.peakBytes = site.liveBytes; }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void removeBytes(const uint8_t callSite, const size_t size)
+{
+    stats.liveBytes -= size;
+    if (callSite != UnknownCallSite) { stats.callSites[callSite].liveBytes -= size; }
+}
+
+// -----------------------------------------------------------------------------
+inline BlockHeader* header(void* block) { return static_cast<BlockHeader*>(block) - 1; }
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+Snapshot snapshot(void)
+{
+    Snapshot snapshot{stats};
+    snapshot.largestFreeBlock = largestFreeBlock();
+    return snapshot;
+}
+
+// -----------------------------------------------------------------------------
+void reset(void)
+{
+    stats.peakBytes = stats.liveBytes;
+    stats.allocations = 0;
+    stats.reallocations = 0;
+    stats.deallocations = 0;
+    stats.failures = 0;
+
+    for (uint8_t i{}; i < stats.numCallSites; ++i)
+    {
+        auto& site{stats.callSites[i]};
+        site.allocations = 0;
+        site.reallocations = 0;
+        site.peakBytes = site.liveBytes;
+    }
+}
+
+// -----------------------------------------------------------------------------
+size_t largestFreeBlock(void)
+{
+#ifdef __AVR__
+    size_t largest{};
+    for (auto block{static_cast<FreeBlock*>(__flp)}; block != nullptr; block = block->next)
+    {
+        if (block->size > largest) { largest = block->size; }
+    }
+
+    char stackTop{};
+    const char* heapTop{__brkval != nullptr ? __brkval : &__heap_start};
+    const size_t margin{__malloc_margin + sizeof(size_t)};
+    const size_t unused{static_cast<size_t>(&stackTop - heapTop)};
+
+    if (unused > margin && unused - margin > largest) { largest = unused - margin; }
+    return largest;
+#else
+    return 0;
+#endif
+}
+
+namespace detail
+{
+
+// -----------------------------------------------------------------------------
+void* allocate(const size_t size, const char* file, const uint16_t line)
+{
+    auto block{static_cast<BlockHeader*>(malloc(sizeof(BlockHeader) + size))};
+    if (block == nullptr)
+    {
+        stats.failures++;
+        return nullptr;
+    }
+
+    block->size = size;
+    block->callSite = callSiteIndex(file, line);
+    stats.allocations++;
+    if (block->callSite != UnknownCallSite) { stats.callSites[block->callSite].allocations++; }
+    addBytes(block->callSite, size);
+    return block + 1;
+}
+
+// -----------------------------------------------------------------------------
+void* reallocate(void* block, const size_t size, const char* file, const uint16_t line)
+{
+    if (block == nullptr) { return allocate(size, file, line); }
+    const auto oldSize{header(block)->size};
+    const auto oldCallSite{header(block)->callSite};
+
+    auto newBlock{static_cast<BlockHeader*>(realloc(header(block), sizeof(BlockHeader) + size))};
+    if (newBlock == nullptr)
+    {
+        stats.failures++;
+        return nullptr;
+    }
+
+    removeBytes(oldCallSite, oldSize);
+    newBlock->size = size;
+    newBlock->callSite = callSiteIndex(file, line);
+    stats.reallocations++;
+    if (newBlock->callSite != UnknownCallSite) { stats.callSites[newBlock->callSite].reallocations++; }
+    addBytes(newBlock->callSite, size);
+    return newBlock + 1;
+}
+
+// -----------------------------------------------------------------------------
+void deallocate(void* block)
+{
+    if (block == nullptr) { return; }
+    removeBytes(header(block)->callSite, header(block)->size);
+    stats.deallocations++;
+    free(header(block));
+}
+
+} // namespace detail
+} // namespace memory_stats
+} // namespace utils
+
+#endif /* UTILS_MEMORY_STATS */
\ No newline at end of file
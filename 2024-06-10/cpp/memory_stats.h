@@ -0,0 +1,123 @@
+/********************************************************************************
+ * @brief Optional instrumentation of the heap allocations performed via
+ *        utils::newMemory, utils::reallocMemory and utils::deleteMemory.
+ *
+ * @note The instrumentation is only compiled when the symbol
+ *       UTILS_MEMORY_STATS is defined for the entire project (add it to the
+ *       symbols in the project settings), since every allocated block is
+ *       given a small header holding its size and call site. Without the
+ *       symbol the memory helpers call malloc, realloc and free directly.
+ *
+ *       Snapshots are plain data and can for instance be printed via
+ *       driver::serial::printf or inspected in a debugger or host build.
+ *
+ *       The file names of the call sites point into the string literals the
+ *       compiler generates for the paths of the allocating files, which are
+ *       placed in SRAM on AVR. The allocations of the containers are recorded
+ *       in their own files, so only a few such literals are referenced.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace utils
+{
+namespace memory_stats
+{
+
+/********************************************************************************
+ * @brief The maximum number of call sites to keep separate counters for.
+ *        Allocations from further call sites are only counted in the totals.
+ ********************************************************************************/
+constexpr uint8_t MaxCallSites{8};
+
+/********************************************************************************
+ * @brief Structure holding counters for a single call site, i.e. a line of
+ *        code that calls newMemory or reallocMemory. Allocations made by
+ *        containers are recorded at the line where the container calls its
+ *        allocator, see allocation.h.
+ *
+ * @param file          The name of the file containing the call, without the
+ *                      directory.
+ * @param line          The line number of the call.
+ * @param allocations   The number of allocations performed at the call site.
+ * @param reallocations The number of reallocations performed at the call site.
+ * @param liveBytes     The number of bytes currently allocated at the call site.
+ * @param peakBytes     The highest number of bytes allocated at the call site.
+ ********************************************************************************/
+struct CallSite
+{
+    const char* file;
+    uint16_t line;
+    uint16_t allocations;
+    uint16_t reallocations;
+    size_t liveBytes;
+    size_t peakBytes;
+};
+
+/********************************************************************************
+ * @brief Structure holding a snapshot of the heap usage.
+ *
+ * @param liveBytes        The number of bytes currently allocated.
+ * @param peakBytes        The highest number of bytes allocated at once
+ *                         (high-water mark).
+ * @param largestFreeBlock The size of the largest block that can currently be
+ *                         allocated in bytes (always 0 on other targets than
+ *                         AVR, where the heap layout is unknown).
+ * @param allocations      The total number of allocations.
+ * @param reallocations    The total number of reallocations.
+ * @param deallocations    The total number of deallocations.
+ * @param failures         The number of failed allocations and reallocations.
+ * @param numCallSites     The number of call sites stored in callSites.
+ * @param callSites        Counters for each call site.
+ ********************************************************************************/
+struct Snapshot
+{
+    size_t liveBytes;
+    size_t peakBytes;
+    size_t largestFreeBlock;
+    uint16_t allocations;
+    uint16_t reallocations;
+    uint16_t deallocations;
+    uint16_t failures;
+    uint8_t numCallSites;
+    CallSite callSites[MaxCallSites];
+};
+
+/********************************************************************************
+ * @brief Provides a snapshot of the current heap usage.
+ *
+ * @return The snapshot.
+ ********************************************************************************/
+Snapshot snapshot(void);
+
+/********************************************************************************
+ * @brief Resets all counters. The peak values are set to the number of bytes
+ *        currently allocated.
+ ********************************************************************************/
+void reset(void);
+
+/********************************************************************************
+ * @brief Provides the size of the largest block that can currently be
+ *        allocated, i.e. the largest free block in the free list or the space
+ *        between the top of the heap and the stack, whichever is larger.
+ *
+ * @return The size of the largest free block in bytes (always 0 on other
+ *         targets than AVR).
+ ********************************************************************************/
+size_t largestFreeBlock(void);
+
+namespace detail
+{
+
+/********************************************************************************
+ * @note Used by the memory helpers in utils.h, don't call these directly.
+ ********************************************************************************/
+void* allocate(const size_t size, const char* file, const uint16_t line);
+void* reallocate(void* block, const size_t size, const char* file, const uint16_t line);
+void deallocate(void* block);
+
+} // namespace detail
+} // namespace memory_stats
+} // namespace utils
\ No newline at end of file
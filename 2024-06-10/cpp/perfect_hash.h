@@ -0,0 +1,117 @@
+/********************************************************************************
+ * @brief Implementation of constant lookup tables stored in program memory,
+ *        where the keys are placed via a perfect hash computed at compile time.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hash.h"
+#include "pair.h"
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#endif
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of constant lookup tables with perfect
+ *        hashing. The table is built from pair entries at compile time, where
+ *        each bucket of keys is assigned a seed that places all its keys in
+ *        distinct slots (hash and displace). A lookup is therefore performed
+ *        by hashing the key twice and comparing a single entry, regardless of
+ *        the size of the table.
+ *
+ *        The table is meant to be stored in program memory, so it occupies
+ *        no RAM:
+ *
+ *            constexpr container::Pair<uint8_t, uint8_t> Segments[]{
+ *                {0, 0x3F}, {1, 0x06}, {2, 0x5B}, {3, 0x4F}};
+ *            constexpr container::PerfectHashTable SegmentTable PROGMEM{Segments};
+ *
+ *            uint8_t pattern{};
+ *            if (SegmentTable.find(2, pattern)) { ... }
+ *
+ * @tparam K          The key type.
+ * @tparam V          The value type.
+ * @tparam NumEntries The number of entries in the table.
+ * @tparam KeyHash    Structure used for hashing and comparing keys, see hash.h
+ *                    (default = container::Hash<K>).
+ *
+ * @note The table must be declared constexpr and PROGMEM, since it's always
+ *       read from program memory on AVR. Building the table fails with a
+ *       compilation error referring to perfectHashDuplicateKey if a key occurs
+ *       twice, and to perfectHashNotFound if no perfect hash could be found,
+ *       which can happen if several keys have the same hash. The table holds
+ *       at least 1.25 slots per entry, rounded up to a power of two, so that
+ *       enough slots stay free for the seed search. Pointers stored
+ *       in the table, such as string keys, still point at their original
+ *       location.
+ ********************************************************************************/
+template <typename K, typename V, size_t NumEntries, typename KeyHash = Hash<K>>
+class PerfectHashTable
+{
+public:
+    /********************************************************************************
+     * @brief Creates table holding referenced entries.
+     *
+     * @param entries Reference to the entries, where first is the key and second
+     *                the value of each entry.
+     ********************************************************************************/
+    constexpr PerfectHashTable(const Pair<K, V> (&entries)[NumEntries]);
+
+    /********************************************************************************
+     * @brief Finds the value stored for specified key.
+     *
+     * @param key   Reference to the key to search for.
+     * @param value Reference to variable for storing the value.
+     *
+     * @return True if the key is present, else false.
+     ********************************************************************************/
+    bool find(const K& key, V& value) const;
+
+    /********************************************************************************
+     * @brief Indicates if specified key is present in the table.
+     *
+     * @param key Reference to the key to search for.
+     *
+     * @return True if the key is present, else false.
+     ********************************************************************************/
+    bool contains(const K& key) const;
+
+    /********************************************************************************
+     * @brief Returns the number of entries in the table.
+     *
+     * @return The number of entries as an unsigned integer.
+     ********************************************************************************/
+    static constexpr size_t size();
+
+private:
+    static_assert(NumEntries > 0, "Perfect hash table cannot be empty!");
+
+    static constexpr size_t numSlots();
+    static constexpr uint32_t mix(const size_t hash, const uint8_t seed);
+    static constexpr size_t slot(const size_t hash, const uint8_t seed);
+    static constexpr size_t bucket(const size_t hash);
+    bool findSlot(const K& key, size_t& index) const;
+    template <typename T>
+    static T read(const T& source);
+
+    static constexpr size_t NumSlots{numSlots()};
+    static constexpr size_t NumBuckets{NumSlots > 1 ? NumSlots / 2 : 1};
+
+    uint8_t mySeeds[NumBuckets]{};
+    uint8_t myUsed[(NumSlots + 7) / 8]{};
+    Pair<K, V> myEntries[NumSlots]{};
+};
+
+} // namespace container
+
+#include "perfect_hash_impl.h"
\ No newline at end of file
@@ -0,0 +1,211 @@
+/********************************************************************************
+ * @brief Implementation details for the container::PerfectHashTable class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace container
+{
+namespace detail
+{
+
+/********************************************************************************
+ * @note These functions aren't constexpr on purpose. Reaching one of them
+ *       while building a table at compile time causes a compilation error.
+ ********************************************************************************/
+inline void perfectHashDuplicateKey() {}
+inline void perfectHashNotFound() {}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+constexpr PerfectHashTable<K, V, NumEntries, KeyHash>::PerfectHashTable(
+    const Pair<K, V> (&entries)[NumEntries])
+{
+    for (size_t i{}; i < NumEntries; ++i)
+    {
+        for (size_t j{i + 1}; j < NumEntries; ++j)
+        {
+            if (KeyHash::equal(entries[i].first, entries[j].first))
+            {
+                detail::perfectHashDuplicateKey();
+            }
+        }
+    }
+
+    size_t hashes[NumEntries]{};
+    size_t bucketSizes[NumBuckets]{};
+    for (size_t i{}; i < NumEntries; ++i)
+    {
+        hashes[i] = KeyHash::hash(entries[i].first);
+        bucketSizes[bucket(hashes[i])]++;
+    }
+
+    // Place the largest buckets first, while most slots are still free.
+    for (size_t size{NumEntries}; size > 0; --size)
+    {
+        for (size_t b{}; b < NumBuckets; ++b)
+        {
+            if (bucketSizes[b] != size) { continue; }
+            size_t members[NumEntries]{};
+            size_t numMembers{};
+            for (size_t i{}; i < NumEntries; ++i)
+            {
+                if (bucket(hashes[i]) == b) { members[numMembers++] = i; }
+            }
+            size_t slots[NumEntries]{};
+            bool placed{false};
+
+            for (uint16_t seed{}; seed <= UINT8_MAX && !placed; ++seed)
+            {
+                placed = true;
+
+                for (size_t i{}; i < numMembers && placed; ++i)
+                {
+                    const auto s{slot(hashes[members[i]], static_cast<uint8_t>(seed))};
+                    if (myUsed[s / 8] & (1 << (s % 8))) { placed = false; }
+                    for (size_t j{}; j < i && placed; ++j)
+                    {
+                        if (slots[j] == s) { placed = false; }
+                    }
+                    slots[i] = s;
+                }
+                if (!placed) { continue; }
+
+                mySeeds[b] = static_cast<uint8_t>(seed);
+                for (size_t i{}; i < numMembers; ++i)
+                {
+                    myUsed[slots[i] / 8] |= static_cast<uint8_t>(1 << (slots[i] % 8));
+                    myEntries[slots[i]] = entries[members[i]];
+                }
+            }
+            if (!placed) { detail::perfectHashNotFound(); }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+bool PerfectHashTable<K, V, NumEntries, KeyHash>::find(const K& key, V& value) const
+{
+    size_t index{};
+    if (!findSlot(key, index)) { return false; }
+    value = read(myEntries[index].second);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+bool PerfectHashTable<K, V, NumEntries, KeyHash>::contains(const K& key) const
+{
+    size_t index{};
+    return findSlot(key, index);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+constexpr size_t PerfectHashTable<K, V, NumEntries, KeyHash>::size() { return NumEntries; }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+constexpr size_t PerfectHashTable<K, V, NumEntries, KeyHash>::numSlots()
+{
+    // Keep at least a fifth of the slots free, since a table without free 
+    // slots rarely has a perfect hash for its last buckets.
+    size_t slots{1};
+    while (slots < NumEntries + NumEntries / 4U) { slots *= 2; }
+    return slots;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+constexpr uint32_t PerfectHashTable<K, V, NumEntries, KeyHash>::mix(const size_t hash,
+                                                                    const uint8_t seed)
+{
+    uint32_t value{static_cast<uint32_t>(hash) ^ static_cast<uint32_t>(seed * 0x9E3779B9UL)};
+    value ^= value >> 16;
+    value *= 0x85EBCA6BUL;
+    value ^= value >> 13;
+    return value;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+constexpr size_t PerfectHashTable<K, V, NumEntries, KeyHash>::slot(const size_t hash,
+                                                                   const uint8_t seed)
+{
+    return static_cast<size_t>(mix(hash, seed) >> 8) & (NumSlots - 1);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+constexpr size_t PerfectHashTable<K, V, NumEntries, KeyHash>::bucket(const size_t hash)
+{
+    // Mix the hash, so that keys differing only in their high bits, such as
+    // multiples of 256, are spread over the buckets.
+    return static_cast<size_t>(mix(hash, 0U)) & (NumBuckets - 1);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+bool PerfectHashTable<K, V, NumEntries, KeyHash>::findSlot(const K& key, 
+                                                           size_t& index) const
+{
+    const auto hash{KeyHash::hash(key)};
+    index = slot(hash, read(mySeeds[bucket(hash)]));
+    if ((read(myUsed[index / 8]) & (1 << (index % 8))) == 0) { return false; }
+    return KeyHash::equal(read(myEntries[index].first), key);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t NumEntries, typename KeyHash>
+template <typename T>
+T PerfectHashTable<K, V, NumEntries, KeyHash>::read(const T& source)
+{
+#ifdef __AVR__
+    T value{};
+    memcpy_P(&value, &source, sizeof(T));
+    return value;
+#else
+    return source;
+#endif
+}
+
+namespace detail
+{
+
+// -----------------------------------------------------------------------------
+template <size_t NumEntries, uint16_t Stride>
+struct PerfectHashCheck
+{
+    Pair<uint16_t, uint8_t> entries[NumEntries]{};
+
+    constexpr PerfectHashCheck()
+    {
+        for (size_t i{}; i < NumEntries; ++i)
+        {
+            entries[i] = {static_cast<uint16_t>(i * Stride), static_cast<uint8_t>(i)};
+        }
+    }
+};
+
+// -----------------------------------------------------------------------------
+template <size_t NumEntries, uint16_t Stride>
+constexpr bool perfectHashBuilds()
+{
+    constexpr PerfectHashCheck<NumEntries, Stride> check{};
+    constexpr PerfectHashTable<uint16_t, uint8_t, NumEntries> table{check.entries};
+    return table.size() == NumEntries;
+}
+
+// Tables whose size is a power of two used to fill every slot and often failed
+// to build, see numSlots. Consecutive keys and keys differing only in their 
+// high byte are checked.
+static_assert(perfectHashBuilds<32, 1>() && perfectHashBuilds<32, 256>() &&
+              perfectHashBuilds<64, 256>() && perfectHashBuilds<128, 256>(),
+              "Perfect hash tables with power-of-two sizes must build!");
+
+} // namespace detail
+} // namespace container
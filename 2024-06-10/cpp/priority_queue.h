@@ -0,0 +1,194 @@
+/********************************************************************************
+ * @brief Implementation of fixed-capacity priority queues of any data type.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+
+#include "algorithm.h"
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of fixed-capacity priority queues. The
+ *        elements are stored inline in a binary heap, so the queue never
+ *        allocates heap memory. Pushing and popping take O(log n) time, while
+ *        the top element is always found at the root of the heap.
+ *
+ *        Each pushed element is assigned a handle, which stays valid until the
+ *        element is popped or removed. The handle can be used to update the
+ *        priority of the element (decrease-key) or to remove it, for instance
+ *        when a pending deadline is moved or cancelled:
+ *
+ *            container::PriorityQueue<uint32_t, 8> deadlines{};
+ *            container::PriorityQueue<uint32_t, 8>::Handle handle{};
+ *            deadlines.push(1000, handle);
+ *            deadlines.update(handle, 500);
+ *
+ * @tparam T        The data type of the queue.
+ * @tparam Capacity The maximum number of elements the queue can hold.
+ * @tparam Compare  Comparison used to order the elements, where the element
+ *                  that compares less than all others is on top
+ *                  (default = container::Less, i.e. the smallest element is on
+ *                  top).
+ *
+ * @note The capacity must exceed 0, else a compilation error will be generated.
+ *       Handles are reused once their elements have left the queue, so a stale
+ *       handle may refer to a newer element.
+ ********************************************************************************/
+template <typename T, size_t Capacity, typename Compare = Less>
+class PriorityQueue
+{
+public:
+    /********************************************************************************
+     * @brief Handle referring to a value in the queue.
+     ********************************************************************************/
+    using Handle = size_t;
+
+    /********************************************************************************
+     * @brief Creates empty priority queue.
+     ********************************************************************************/
+    PriorityQueue();
+
+    /********************************************************************************
+     * @brief Deletes priority queue.
+     ********************************************************************************/
+    ~PriorityQueue();
+
+    /********************************************************************************
+     * @brief Pushes referenced value to the queue.
+     *
+     * @param value Reference to the value to push.
+     *
+     * @return True if the value was pushed, false if the queue is full.
+     ********************************************************************************/
+    bool push(const T& value);
+
+    /********************************************************************************
+     * @brief Pushes referenced value to the queue.
+     *
+     * @param value  Reference to the value to push.
+     * @param handle Reference to variable for storing the handle of the value.
+     *
+     * @return True if the value was pushed, false if the queue is full.
+     ********************************************************************************/
+    bool push(const T& value, Handle& handle);
+
+    /********************************************************************************
+     * @brief Pops the top value of the queue.
+     *
+     * @param value Reference to variable for storing the popped value.
+     *
+     * @return True if a value was popped, false if the queue is empty.
+     ********************************************************************************/
+    bool pop(T& value);
+
+    /********************************************************************************
+     * @brief Pops the top value of the queue without reading it.
+     *
+     * @return True if a value was popped, false if the queue is empty.
+     ********************************************************************************/
+    bool pop();
+
+    /********************************************************************************
+     * @brief Provides the top value of the queue without removing it.
+     *
+     * @return A pointer to the top value, or a null pointer if the queue is empty.
+     ********************************************************************************/
+    const T* peek() const;
+
+    /********************************************************************************
+     * @brief Provides the value referred to by specified handle.
+     *
+     * @param handle The handle of the value.
+     *
+     * @return A pointer to the value, or a null pointer if the handle doesn't
+     *         refer to a value in the queue.
+     ********************************************************************************/
+    const T* find(const Handle handle) const;
+
+    /********************************************************************************
+     * @brief Replaces the value referred to by specified handle and restores the
+     *        order of the queue. The new value may be placed both before
+     *        (decrease-key) and after the old value.
+     *
+     * @param handle The handle of the value to update.
+     * @param value  Reference to the new value.
+     *
+     * @return True if the value was updated, false if the handle doesn't refer
+     *         to a value in the queue.
+     ********************************************************************************/
+    bool update(const Handle handle, const T& value);
+
+    /********************************************************************************
+     * @brief Removes the value referred to by specified handle.
+     *
+     * @param handle The handle of the value to remove.
+     *
+     * @return True if the value was removed, false if the handle doesn't refer
+     *         to a value in the queue.
+     ********************************************************************************/
+    bool remove(const Handle handle);
+
+    /********************************************************************************
+     * @brief Indicates if specified handle refers to a value in the queue.
+     *
+     * @param handle The handle to check.
+     *
+     * @return True if the handle refers to a value in the queue, else false.
+     ********************************************************************************/
+    bool contains(const Handle handle) const;
+
+    /********************************************************************************
+     * @brief Removes all values from the queue.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Returns the number of values stored in the queue.
+     *
+     * @return The number of values as an unsigned integer.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Returns the capacity of the queue.
+     *
+     * @return The maximum number of values the queue can hold.
+     ********************************************************************************/
+    static constexpr size_t capacity();
+
+    /********************************************************************************
+     * @brief Indicates if the queue is empty.
+     *
+     * @return True if the queue is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Indicates if the queue is full.
+     *
+     * @return True if the queue is full, else false.
+     ********************************************************************************/
+    bool full() const;
+
+private:
+    static_assert(Capacity > 0, "Priority queue capacity cannot be set to 0!");
+
+    bool before(const size_t a, const size_t b) const;
+    void swapNodes(const size_t a, const size_t b);
+    void siftUp(size_t index);
+    void siftDown(size_t index);
+
+    // The heap holds the handles of the values, where the handles after the
+    // last value are free. Each handle indexes both the values and the heap
+    // positions, so the values themselves never move.
+    T myValues[Capacity]{};
+    Handle myHeap[Capacity]{};
+    size_t myPositions[Capacity]{};
+    size_t mySize{};
+};
+
+} // namespace container
+
+#include "priority_queue_impl.h"
\ No newline at end of file
@@ -0,0 +1,179 @@
+/********************************************************************************
+ * @brief Implementation details for the container::PriorityQueue class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+#include "utils.h"
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+PriorityQueue<T, Capacity, Compare>::PriorityQueue() { clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+PriorityQueue<T, Capacity, Compare>::~PriorityQueue() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::push(const T& value)
+{
+    Handle handle{};
+    return push(value, handle);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::push(const T& value, Handle& handle)
+{
+    if (mySize == Capacity) { return false; }
+    handle = myHeap[mySize];
+    myValues[handle] = value;
+    siftUp(mySize++);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::pop(T& value)
+{
+    if (mySize == 0) { return false; }
+    value = utils::move(myValues[myHeap[0]]);
+    return remove(myHeap[0]);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::pop()
+{
+    return mySize > 0 ? remove(myHeap[0]) : false;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+const T* PriorityQueue<T, Capacity, Compare>::peek() const
+{
+    return mySize > 0 ? &myValues[myHeap[0]] : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+const T* PriorityQueue<T, Capacity, Compare>::find(const Handle handle) const
+{
+    return contains(handle) ? &myValues[handle] : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::update(const Handle handle, const T& value)
+{
+    if (!contains(handle)) { return false; }
+    myValues[handle] = value;
+    siftUp(myPositions[handle]);
+    siftDown(myPositions[handle]);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::remove(const Handle handle)
+{
+    if (!contains(handle)) { return false; }
+    const auto index{myPositions[handle]};
+
+    // Move the handle past the last value, where it's free for reuse.
+    swapNodes(index, --mySize);
+    if (index < mySize)
+    {
+        const auto moved{myHeap[index]};
+        siftUp(index);
+        siftDown(myPositions[moved]);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::contains(const Handle handle) const
+{
+    return handle < Capacity && myPositions[handle] < mySize;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+void PriorityQueue<T, Capacity, Compare>::clear()
+{
+    for (size_t i{}; i < Capacity; ++i)
+    {
+        myHeap[i] = i;
+        myPositions[i] = i;
+    }
+    mySize = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+size_t PriorityQueue<T, Capacity, Compare>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+constexpr size_t PriorityQueue<T, Capacity, Compare>::capacity() { return Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::full() const { return mySize == Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+bool PriorityQueue<T, Capacity, Compare>::before(const size_t a, const size_t b) const
+{
+    return Compare{}(myValues[myHeap[a]], myValues[myHeap[b]]);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+void PriorityQueue<T, Capacity, Compare>::swapNodes(const size_t a, const size_t b)
+{
+    utils::swap(myHeap[a], myHeap[b]);
+    myPositions[myHeap[a]] = a;
+    myPositions[myHeap[b]] = b;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+void PriorityQueue<T, Capacity, Compare>::siftUp(size_t index)
+{
+    while (index > 0)
+    {
+        const auto parent{(index - 1) / 2};
+        if (!before(index, parent)) { return; }
+        swapNodes(index, parent);
+        index = parent;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity, typename Compare>
+void PriorityQueue<T, Capacity, Compare>::siftDown(size_t index)
+{
+    while (true)
+    {
+        const auto left{2 * index + 1};
+        if (left >= mySize) { return; }
+        const auto right{left + 1};
+        const auto child{right < mySize && before(right, left) ? right : left};
+        if (!before(child, index)) { return; }
+        swapNodes(index, child);
+        index = child;
+    }
+}
+
+} // namespace container
\ No newline at end of file
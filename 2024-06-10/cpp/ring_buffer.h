@@ -0,0 +1,134 @@
+/********************************************************************************
+ * @brief Implementation of lock-free ring buffers for passing data between a
+ *        single producer and a single consumer, such as an interrupt service
+ *        routine and the main loop.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of single-producer/single-consumer ring
+ *        buffers. The head index is only written by the producer and the tail
+ *        index is only written by the consumer. Both indexes are single bytes,
+ *        which are read and written atomically, so no interrupts have to be
+ *        disabled when accessing the buffer.
+ *
+ * @tparam T    The data type of the buffer.
+ * @tparam Size The number of elements the buffer can hold.
+ *
+ * @note The size must be a power of two in the range 2 - 128, else a
+ *       compilation error will be generated.
+ ********************************************************************************/
+template <typename T, size_t Size>
+class RingBuffer
+{
+public:
+    /********************************************************************************
+     * @brief Creates empty ring buffer.
+     ********************************************************************************/
+    RingBuffer();
+
+    /********************************************************************************
+     * @brief Deletes ring buffer.
+     ********************************************************************************/
+    ~RingBuffer();
+
+    /********************************************************************************
+     * @brief Copy constructor deleted.
+     ********************************************************************************/
+    RingBuffer(RingBuffer&) = delete;
+
+    /********************************************************************************
+     * @brief Assignment operator deleted.
+     ********************************************************************************/
+    RingBuffer& operator=(RingBuffer&) = delete;
+
+    /********************************************************************************
+     * @brief Move constructor deleted.
+     ********************************************************************************/
+    RingBuffer(RingBuffer&&) = delete;
+
+    /********************************************************************************
+     * @brief Pushes referenced value to the buffer. May only be called by the
+     *        producer.
+     *
+     * @param value Reference to the value to push.
+     *
+     * @return True if the value was pushed, false if the buffer is full.
+     ********************************************************************************/
+    bool push(const T& value);
+
+    /********************************************************************************
+     * @brief Pops the oldest value of the buffer. May only be called by the
+     *        consumer.
+     *
+     * @param value Reference to variable for storing the popped value.
+     *
+     * @return True if a value was popped, false if the buffer is empty.
+     ********************************************************************************/
+    bool pop(T& value);
+
+    /********************************************************************************
+     * @brief Reads the oldest value of the buffer without popping it. May only
+     *        be called by the consumer.
+     *
+     * @param value Reference to variable for storing the value.
+     *
+     * @return True if a value was read, false if the buffer is empty.
+     ********************************************************************************/
+    bool peek(T& value) const;
+
+    /********************************************************************************
+     * @brief Removes all values from the buffer. May only be called by the
+     *        consumer.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Returns the number of values stored in the buffer.
+     *
+     * @return The number of stored values as an unsigned integer.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Returns the capacity of the buffer.
+     *
+     * @return The number of values the buffer can hold.
+     ********************************************************************************/
+    static constexpr size_t capacity();
+
+    /********************************************************************************
+     * @brief Indicates if the buffer is empty.
+     *
+     * @return True if the buffer is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Indicates if the buffer is full.
+     *
+     * @return True if the buffer is full, else false.
+     ********************************************************************************/
+    bool full() const;
+
+private:
+    static_assert(Size >= 2 && Size <= 128 && (Size & (Size - 1)) == 0,
+        "Ring buffer size must be a power of two in the range 2 - 128!");
+    static constexpr uint8_t IndexMask{Size - 1};
+
+    static uint8_t load(const volatile uint8_t& index);
+    static void store(volatile uint8_t& index, const uint8_t value);
+
+    T myData[Size]{};
+    volatile uint8_t myHead{};
+    volatile uint8_t myTail{};
+};
+
+} // namespace container
+
+#include "ring_buffer_impl.h"
\ No newline at end of file
@@ -0,0 +1,88 @@
+/********************************************************************************
+ * @brief Implementation details for the container::RingBuffer class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+RingBuffer<T, Size>::RingBuffer() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+RingBuffer<T, Size>::~RingBuffer() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+bool RingBuffer<T, Size>::push(const T& value)
+{
+    const uint8_t head{myHead};
+    if (static_cast<uint8_t>(head - load(myTail)) == Size) { return false; }
+    myData[head & IndexMask] = value;
+    store(myHead, head + 1);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+bool RingBuffer<T, Size>::pop(T& value)
+{
+    const uint8_t tail{myTail};
+    if (load(myHead) == tail) { return false; }
+    value = myData[tail & IndexMask];
+    store(myTail, tail + 1);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+bool RingBuffer<T, Size>::peek(T& value) const
+{
+    const uint8_t tail{myTail};
+    if (load(myHead) == tail) { return false; }
+    value = myData[tail & IndexMask];
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void RingBuffer<T, Size>::clear() { store(myTail, load(myHead)); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+size_t RingBuffer<T, Size>::size() const
+{
+    return static_cast<uint8_t>(load(myHead) - load(myTail));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+constexpr size_t RingBuffer<T, Size>::capacity() { return Size; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+bool RingBuffer<T, Size>::empty() const { return size() == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+bool RingBuffer<T, Size>::full() const { return size() == Size; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+uint8_t RingBuffer<T, Size>::load(const volatile uint8_t& index)
+{
+    return __atomic_load_n(&index, __ATOMIC_ACQUIRE);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void RingBuffer<T, Size>::store(volatile uint8_t& index, const uint8_t value)
+{
+    __atomic_store_n(&index, value, __ATOMIC_RELEASE);
+}
+
+} // namespace container
\ No newline at end of file
@@ -0,0 +1,152 @@
+/********************************************************************************
+ * @brief Implementation of sliding windows tracking the minimum, maximum and
+ *        sum of the most recent samples of a signal.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of sliding windows. The window holds the
+ *        last Size samples pushed to it, where the oldest sample is dropped
+ *        when a new sample is pushed to a full window.
+ *
+ *        The minimum and maximum are tracked via monotonic queues, which only
+ *        hold the samples that can still become the minimum or maximum of the
+ *        window. The sum is updated by adding the new sample and subtracting
+ *        the dropped one. Each push is therefore performed in amortized
+ *        constant time and the minimum, maximum and sum are read in constant
+ *        time, instead of rescanning the window for each sample.
+ *
+ *        All storage is held inline, no memory is allocated.
+ *
+ * @tparam T    The data type of the samples.
+ * @tparam Size The number of samples in the window.
+ * @tparam Sum  The data type of the sum (default = T). Select a wider type
+ *              if the sum of Size samples can overflow T.
+ *
+ * @note The size must be in the range 1 - 255, else a compilation error will
+ *       be generated.
+ ********************************************************************************/
+template <typename T, size_t Size, typename Sum = T>
+class SlidingWindow
+{
+public:
+    /********************************************************************************
+     * @brief Creates empty sliding window.
+     ********************************************************************************/
+    SlidingWindow();
+
+    /********************************************************************************
+     * @brief Deletes sliding window.
+     ********************************************************************************/
+    ~SlidingWindow();
+
+    /********************************************************************************
+     * @brief Pushes new sample to the window. The oldest sample is dropped if
+     *        the window is full.
+     *
+     * @param sample Reference to the sample to push.
+     ********************************************************************************/
+    void push(const T& sample);
+
+    /********************************************************************************
+     * @brief Returns the smallest sample in the window.
+     *
+     * @return The smallest sample or 0 if the window is empty.
+     ********************************************************************************/
+    T min() const;
+
+    /********************************************************************************
+     * @brief Returns the largest sample in the window.
+     *
+     * @return The largest sample or 0 if the window is empty.
+     ********************************************************************************/
+    T max() const;
+
+    /********************************************************************************
+     * @brief Returns the sum of the samples in the window.
+     *
+     * @return The sum of the samples.
+     ********************************************************************************/
+    Sum sum() const;
+
+    /********************************************************************************
+     * @brief Returns the average of the samples in the window.
+     *
+     * @return The average of the samples or 0 if the window is empty.
+     ********************************************************************************/
+    Sum average() const;
+
+    /********************************************************************************
+     * @brief Returns the most recently pushed sample.
+     *
+     * @return The newest sample or 0 if the window is empty.
+     ********************************************************************************/
+    T newest() const;
+
+    /********************************************************************************
+     * @brief Returns the number of samples in the window.
+     *
+     * @return The number of samples.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Returns the capacity of the window.
+     *
+     * @return The maximum number of samples the window can hold.
+     ********************************************************************************/
+    static constexpr size_t capacity() { return Size; }
+
+    /********************************************************************************
+     * @brief Indicates if the window is empty.
+     *
+     * @return True if the window is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Indicates if the window is full.
+     *
+     * @return True if the window holds Size samples, else false.
+     ********************************************************************************/
+    bool full() const;
+
+    /********************************************************************************
+     * @brief Removes all samples from the window.
+     ********************************************************************************/
+    void clear();
+
+private:
+    static_assert(Size >= 1 && Size <= UINT8_MAX,
+        "Sliding window size must be in the range 1 - 255!");
+    static uint8_t nextPosition(const uint8_t position);
+
+    struct Queue
+    {
+        uint8_t positions[Size];
+        uint8_t head;
+        uint8_t count;
+
+        uint8_t front() const;
+        uint8_t back() const;
+        void popFront();
+        void popBack();
+        void pushBack(const uint8_t position);
+    };
+
+    T mySamples[Size]{};
+    Queue myMinQueue{};
+    Queue myMaxQueue{};
+    uint8_t myNext{};
+    uint8_t myCount{};
+    Sum mySum{};
+};
+
+} // namespace container
+
+#include "sliding_window_impl.h"
\ No newline at end of file
@@ -0,0 +1,147 @@
+/********************************************************************************
+ * @brief Implementation details for the container::SlidingWindow class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+SlidingWindow<T, Size, Sum>::SlidingWindow() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+SlidingWindow<T, Size, Sum>::~SlidingWindow() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+void SlidingWindow<T, Size, Sum>::push(const T& sample)
+{
+    // Drop the oldest sample, which is placed where the new sample is stored.
+    if (myCount == Size)
+    {
+        mySum -= static_cast<Sum>(mySamples[myNext]);
+        if (myMinQueue.front() == myNext) { myMinQueue.popFront(); }
+        if (myMaxQueue.front() == myNext) { myMaxQueue.popFront(); }
+    }
+    else { myCount++; }
+
+    // Older samples that can no longer become the minimum or maximum are removed.
+    while (myMinQueue.count > 0 && !(mySamples[myMinQueue.back()] < sample))
+    {
+        myMinQueue.popBack();
+    }
+    while (myMaxQueue.count > 0 && !(sample < mySamples[myMaxQueue.back()]))
+    {
+        myMaxQueue.popBack();
+    }
+
+    mySamples[myNext] = sample;
+    mySum += static_cast<Sum>(sample);
+    myMinQueue.pushBack(myNext);
+    myMaxQueue.pushBack(myNext);
+    myNext = nextPosition(myNext);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+T SlidingWindow<T, Size, Sum>::min() const
+{
+    return myCount > 0 ? mySamples[myMinQueue.front()] : static_cast<T>(0);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+T SlidingWindow<T, Size, Sum>::max() const
+{
+    return myCount > 0 ? mySamples[myMaxQueue.front()] : static_cast<T>(0);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+Sum SlidingWindow<T, Size, Sum>::sum() const { return mySum; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+Sum SlidingWindow<T, Size, Sum>::average() const
+{
+    return myCount > 0 ? mySum / static_cast<Sum>(myCount) : static_cast<Sum>(0);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+T SlidingWindow<T, Size, Sum>::newest() const
+{
+    if (myCount == 0) { return static_cast<T>(0); }
+    return mySamples[myNext > 0 ? myNext - 1U : Size - 1U];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+size_t SlidingWindow<T, Size, Sum>::size() const { return myCount; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+bool SlidingWindow<T, Size, Sum>::empty() const { return myCount == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+bool SlidingWindow<T, Size, Sum>::full() const { return myCount == Size; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+void SlidingWindow<T, Size, Sum>::clear()
+{
+    myMinQueue.head = 0;
+    myMinQueue.count = 0;
+    myMaxQueue.head = 0;
+    myMaxQueue.count = 0;
+    myNext = 0;
+    myCount = 0;
+    mySum = static_cast<Sum>(0);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+uint8_t SlidingWindow<T, Size, Sum>::nextPosition(const uint8_t position)
+{
+    return position + 1U < Size ? position + 1U : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+uint8_t SlidingWindow<T, Size, Sum>::Queue::front() const { return positions[head]; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+uint8_t SlidingWindow<T, Size, Sum>::Queue::back() const
+{
+    const size_t index{head + count - 1U};
+    return positions[index < Size ? index : index - Size];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+void SlidingWindow<T, Size, Sum>::Queue::popFront()
+{
+    head = nextPosition(head);
+    count--;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+void SlidingWindow<T, Size, Sum>::Queue::popBack() { count--; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Sum>
+void SlidingWindow<T, Size, Sum>::Queue::pushBack(const uint8_t position)
+{
+    const size_t index{static_cast<size_t>(head) + count};
+    positions[index < Size ? index : index - Size] = position;
+    count++;
+}
+
+} // namespace container
\ No newline at end of file
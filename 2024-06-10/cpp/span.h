@@ -0,0 +1,257 @@
+/********************************************************************************
+ * @brief Implementation of non-owning views of contiguous elements.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+
+#include "array.h"
+#include "static_vector.h"
+#include "type_traits.h"
+#include "vector.h"
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of spans, i.e. views of contiguous elements
+ *        owned by someone else, such as an array, a vector or a raw buffer.
+ *        A span only holds a pointer and a size, so it can be passed by value
+ *        to functions taking any kind of collection without copying elements:
+ *
+ *            void print(container::Span<const uint8_t> bytes);
+ *
+ *            container::Array<uint8_t, 4> array{1, 2, 3, 4};
+ *            container::Vector<uint8_t> vector{5, 6};
+ *            print(array);
+ *            print(vector);
+ *
+ *        A span of const elements (see ConstSpan below) provides read access
+ *        only, while a span of mutable elements can be used to modify the
+ *        viewed elements.
+ *
+ * @tparam T The data type of the viewed elements.
+ *
+ * @note The span doesn't own the viewed elements, so it must not outlive them.
+ *       Resizing a vector may move its elements, which invalidates spans
+ *       created from it.
+ ********************************************************************************/
+template <typename T>
+class Span
+{
+public:
+    /********************************************************************************
+     * @brief Creates empty span.
+     ********************************************************************************/
+    constexpr Span();
+
+    /********************************************************************************
+     * @brief Creates span viewing specified number of elements.
+     *
+     * @param data Pointer to the first element.
+     * @param size The number of elements to view.
+     ********************************************************************************/
+    constexpr Span(T* data, const size_t size);
+
+    /********************************************************************************
+     * @brief Creates span viewing referenced raw array.
+     *
+     * @tparam U    The data type of the array.
+     * @tparam Size The array size.
+     *
+     * @param values Reference to the array to view.
+     ********************************************************************************/
+    template <typename U, size_t Size>
+    constexpr Span(U (&values)[Size]);
+
+    /********************************************************************************
+     * @brief Creates span viewing referenced array.
+     *
+     * @tparam U    The data type of the array.
+     * @tparam Size The array size.
+     *
+     * @param array Reference to the array to view.
+     ********************************************************************************/
+    template <typename U, size_t Size>
+    constexpr Span(Array<U, Size>& array);
+
+    /********************************************************************************
+     * @brief Creates span viewing referenced array.
+     *
+     * @tparam U    The data type of the array.
+     * @tparam Size The array size.
+     *
+     * @param array Reference to the array to view.
+     ********************************************************************************/
+    template <typename U, size_t Size>
+    constexpr Span(const Array<U, Size>& array);
+
+    /********************************************************************************
+     * @brief Creates span viewing the elements of referenced vector.
+     *
+     * @tparam U          The data type of the vector.
+     * @tparam Allocation The allocation policy of the vector.
+     *
+     * @param vector Reference to the vector to view.
+     ********************************************************************************/
+    template <typename U, typename Allocation>
+    constexpr Span(Vector<U, Allocation>& vector);
+
+    /********************************************************************************
+     * @brief Creates span viewing the elements of referenced vector.
+     *
+     * @tparam U          The data type of the vector.
+     * @tparam Allocation The allocation policy of the vector.
+     *
+     * @param vector Reference to the vector to view.
+     ********************************************************************************/
+    template <typename U, typename Allocation>
+    constexpr Span(const Vector<U, Allocation>& vector);
+
+    /********************************************************************************
+     * @brief Creates span viewing the elements of referenced static vector.
+     *
+     * @tparam U        The data type of the vector.
+     * @tparam Capacity The capacity of the vector.
+     *
+     * @param vector Reference to the vector to view.
+     ********************************************************************************/
+    template <typename U, size_t Capacity>
+    constexpr Span(StaticVector<U, Capacity>& vector);
+
+    /********************************************************************************
+     * @brief Creates span viewing the elements of referenced static vector.
+     *
+     * @tparam U        The data type of the vector.
+     * @tparam Capacity The capacity of the vector.
+     *
+     * @param vector Reference to the vector to view.
+     ********************************************************************************/
+    template <typename U, size_t Capacity>
+    constexpr Span(const StaticVector<U, Capacity>& vector);
+
+    /********************************************************************************
+     * @brief Creates span viewing the same elements as referenced other span,
+     *        for instance to turn a span of mutable elements into a span of
+     *        const elements.
+     *
+     * @tparam U The data type of the other span.
+     *
+     * @param other Reference to the other span.
+     ********************************************************************************/
+    template <typename U>
+    constexpr Span(const Span<U>& other);
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified index in the span.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return A reference to the element at specified index.
+     ********************************************************************************/
+    constexpr T& operator[](const size_t index) const;
+
+    /********************************************************************************
+     * @brief Provides the viewed elements.
+     *
+     * @return Pointer to the first element.
+     ********************************************************************************/
+    constexpr T* data() const;
+
+    /********************************************************************************
+     * @brief Returns the size of the span.
+     *
+     * @return The number of viewed elements as an unsigned integer.
+     ********************************************************************************/
+    constexpr size_t size() const;
+
+    /********************************************************************************
+     * @brief Indicates if the span is empty.
+     *
+     * @return True if the span views no elements, else false.
+     ********************************************************************************/
+    constexpr bool empty() const;
+
+    /********************************************************************************
+     * @brief Provides the start address of the span.
+     *
+     * @return Pointer to the first element.
+     ********************************************************************************/
+    constexpr T* begin() const;
+
+    /********************************************************************************
+     * @brief Provides the end address of the span.
+     *
+     * @return Pointer to the address after the last element.
+     ********************************************************************************/
+    constexpr T* end() const;
+
+    /********************************************************************************
+     * @brief Provides a span viewing the first elements of the span.
+     *
+     * @param count The number of elements to view. The count is limited to the
+     *              size of the span.
+     *
+     * @return The new span.
+     ********************************************************************************/
+    constexpr Span first(const size_t count) const;
+
+    /********************************************************************************
+     * @brief Provides a span viewing the last elements of the span.
+     *
+     * @param count The number of elements to view. The count is limited to the
+     *              size of the span.
+     *
+     * @return The new span.
+     ********************************************************************************/
+    constexpr Span last(const size_t count) const;
+
+    /********************************************************************************
+     * @brief Provides a span viewing a part of the span.
+     *
+     * @param offset Index of the first element to view. The offset is limited to
+     *               the size of the span.
+     * @param count  The number of elements to view. The count is limited to the
+     *               number of elements after the offset.
+     *
+     * @return The new span.
+     ********************************************************************************/
+    constexpr Span subspan(const size_t offset, const size_t count) const;
+
+private:
+    template <typename U>
+    static constexpr bool isQualificationOf();
+
+    T* myData{nullptr};
+    size_t mySize{};
+};
+
+/********************************************************************************
+ * @brief Deduction guides, which make it possible to omit the element type when
+ *        creating a span from a collection, e.g. container::Span view{array}.
+ ********************************************************************************/
+template <typename T, size_t Size>
+Span(T (&)[Size]) -> Span<T>;
+template <typename T, size_t Size>
+Span(Array<T, Size>&) -> Span<T>;
+template <typename T, size_t Size>
+Span(const Array<T, Size>&) -> Span<const T>;
+template <typename T, typename Allocation>
+Span(Vector<T, Allocation>&) -> Span<T>;
+template <typename T, typename Allocation>
+Span(const Vector<T, Allocation>&) -> Span<const T>;
+template <typename T, size_t Capacity>
+Span(StaticVector<T, Capacity>&) -> Span<T>;
+template <typename T, size_t Capacity>
+Span(const StaticVector<T, Capacity>&) -> Span<const T>;
+
+/********************************************************************************
+ * @brief Span providing read access only.
+ *
+ * @tparam T The data type of the viewed elements.
+ ********************************************************************************/
+template <typename T>
+using ConstSpan = Span<const T>;
+
+} // namespace container
+
+#include "span_impl.h"
\ No newline at end of file
@@ -0,0 +1,168 @@
+/********************************************************************************
+ * @brief Implementation details for the container::Span class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T>::Span() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T>::Span(T* data, const size_t size)
+    : myData{data}
+    , mySize{data != nullptr ? size : 0} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U, size_t Size>
+constexpr Span<T>::Span(U (&values)[Size])
+    : myData{values}
+    , mySize{Size}
+{
+    static_assert(isQualificationOf<U>(),
+        "A span can only add const or volatile qualifiers to the viewed elements!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U, size_t Size>
+constexpr Span<T>::Span(Array<U, Size>& array)
+    : myData{array.data()}
+    , mySize{Size}
+{
+    static_assert(isQualificationOf<U>(),
+        "A span can only add const or volatile qualifiers to the viewed elements!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U, size_t Size>
+constexpr Span<T>::Span(const Array<U, Size>& array)
+    : myData{array.data()}
+    , mySize{Size}
+{
+    static_assert(isQualificationOf<U>(),
+        "A span can only add const or volatile qualifiers to the viewed elements!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U, typename Allocation>
+constexpr Span<T>::Span(Vector<U, Allocation>& vector)
+    : myData{vector.data()}
+    , mySize{vector.size()}
+{
+    static_assert(isQualificationOf<U>(),
+        "A span can only add const or volatile qualifiers to the viewed elements!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U, typename Allocation>
+constexpr Span<T>::Span(const Vector<U, Allocation>& vector)
+    : myData{vector.data()}
+    , mySize{vector.size()}
+{
+    static_assert(isQualificationOf<U>(),
+        "A span can only add const or volatile qualifiers to the viewed elements!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U, size_t Capacity>
+constexpr Span<T>::Span(StaticVector<U, Capacity>& vector)
+    : myData{vector.data()}
+    , mySize{vector.size()}
+{
+    static_assert(isQualificationOf<U>(),
+        "A span can only add const or volatile qualifiers to the viewed elements!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U, size_t Capacity>
+constexpr Span<T>::Span(const StaticVector<U, Capacity>& vector)
+    : myData{vector.data()}
+    , mySize{vector.size()}
+{
+    static_assert(isQualificationOf<U>(),
+        "A span can only add const or volatile qualifiers to the viewed elements!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U>
+constexpr Span<T>::Span(const Span<U>& other)
+    : myData{other.data()}
+    , mySize{other.size()}
+{
+    static_assert(isQualificationOf<U>(),
+        "A span can only add const or volatile qualifiers to the viewed elements!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U>
+constexpr bool Span<T>::isQualificationOf()
+{
+    // Converting U* to T* is also allowed from derived to base classes, where the
+    // element size differs, so the types must match apart from qualifiers.
+    return type_traits::is_same<typename type_traits::remove_cv<U>::type,
+                                typename type_traits::remove_cv<T>::type>::value;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T& Span<T>::operator[](const size_t index) const { return myData[index]; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T* Span<T>::data() const { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr size_t Span<T>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr bool Span<T>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T* Span<T>::begin() const { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T* Span<T>::end() const { return myData + mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T> Span<T>::first(const size_t count) const
+{
+    return Span{myData, count < mySize ? count : mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T> Span<T>::last(const size_t count) const
+{
+    const auto numElements{count < mySize ? count : mySize};
+    return Span{myData + (mySize - numElements), numElements};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T> Span<T>::subspan(const size_t offset, const size_t count) const
+{
+    const auto start{offset < mySize ? offset : mySize};
+    const auto remaining{mySize - start};
+    return Span{myData + start, count < remaining ? count : remaining};
+}
+
+} // namespace container
\ No newline at end of file
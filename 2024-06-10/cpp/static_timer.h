@@ -0,0 +1,116 @@
+/********************************************************************************
+ * @brief Driver for ATmega328P hardware timers with elapse times fixed at
+ *        compile time.
+ ********************************************************************************/
+#pragma once
+
+#include "timer.h"
+
+namespace driver
+{
+namespace detail
+{
+
+/********************************************************************************
+ * @note Used by driver::StaticTimer, don't use these directly.
+ ********************************************************************************/
+struct TimerSetting
+{
+    uint16_t prescaler;
+    uint8_t clockSelect;
+    uint16_t compareValue;
+    uint32_t maxCount;
+};
+
+template <Timer::Circuit TimerCircuit>
+constexpr TimerSetting timerSetting(const uint32_t cyclesPerElapse);
+
+template <Timer::Circuit TimerCircuit>
+constexpr Timer::HardwareConfig hardwareConfig(const TimerSetting& setting);
+
+} // namespace detail
+
+/********************************************************************************
+ * @brief Class for hardware timers, whose register settings are computed at
+ *        compile time from the elapse time. The timer circuit runs in CTC mode
+ *        (clear timer on compare match), where the prescaler, the compare value
+ *        and the number of interrupts per elapse time are selected so that the
+ *        elapse time is generated exactly with as few interrupts as possible.
+ *        Hence no settings are computed at runtime, for instance
+ *
+ *            StaticTimer<Timer::Circuit::Timer1, 100U> timer1{};
+ *
+ *        runs Timer 1 with prescaler 64 and compare value 24 999, which
+ *        generates one interrupt every 100 ms.
+ *
+ * @tparam TimerCircuit The selected timer circuit (Timer 0 - Timer 2).
+ * @tparam ElapseTimeMs The elapse time of the timer in ms.
+ *
+ * @note A compilation error is generated if the elapse time is 0 or can't be
+ *       generated exactly by the selected circuit. Unlike driver::Timer, the
+ *       elapse time can't be changed after creation.
+ ********************************************************************************/
+template <Timer::Circuit TimerCircuit, uint16_t ElapseTimeMs>
+class StaticTimer : private Timer
+{
+    static_assert(F_CPU % 1000UL == 0U, "The CPU frequency must be a multiple of 1 kHz!");
+    static_assert(ElapseTimeMs > 0U, "The elapse time of a timer must exceed 0 ms!");
+    static_assert(ElapseTimeMs <= UINT32_MAX / (F_CPU / 1000UL),
+        "The elapse time is too long for the CPU frequency!");
+
+    static constexpr detail::TimerSetting Setting{
+        detail::timerSetting<TimerCircuit>(F_CPU / 1000UL * ElapseTimeMs)};
+
+    static_assert(Setting.maxCount > 0U,
+        "The elapse time can't be generated exactly by the selected timer circuit!");
+
+    static constexpr HardwareConfig Config{detail::hardwareConfig<TimerCircuit>(Setting)};
+
+public:
+
+    /********************************************************************************
+     * @brief The prescaler of the timer circuit.
+     ********************************************************************************/
+    static constexpr uint16_t Prescaler{Setting.prescaler};
+
+    /********************************************************************************
+     * @brief The compare value of the timer circuit, i.e. the number of timer
+     *        clock cycles per interrupt minus one.
+     ********************************************************************************/
+    static constexpr uint16_t CompareValue{Setting.compareValue};
+
+    /********************************************************************************
+     * @brief The number of interrupts per elapse time.
+     ********************************************************************************/
+    static constexpr uint32_t MaxCount{Setting.maxCount};
+
+    /********************************************************************************
+     * @brief Creates new timer if the selected circuit isn't already reserved.
+     *
+     * @param startTimer Indicates if the timer is to be started immediately after
+     *                   initialization (default = false, i.e. timer not started).
+     ********************************************************************************/
+    explicit StaticTimer(const bool startTimer = false);
+
+    /********************************************************************************
+     * @brief Deletes timer.
+     ********************************************************************************/
+    ~StaticTimer() = default;
+
+    using Timer::circuit;
+    using Timer::isEnabled;
+    using Timer::setEnabled;
+    using Timer::elapseTimeMs;
+    using Timer::start;
+    using Timer::stop;
+    using Timer::toggle;
+    using Timer::restart;
+    using Timer::addCallback;
+    using Timer::removeCallback;
+    using Timer::increment;
+    using Timer::hasElapsed;
+};
+
+} // namespace driver
+
+#include "static_timer_impl.h"
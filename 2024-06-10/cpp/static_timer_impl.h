@@ -0,0 +1,79 @@
+/********************************************************************************
+ * @brief Implementation details for the driver::StaticTimer class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace driver
+{
+namespace detail
+{
+
+// -----------------------------------------------------------------------------
+template <Timer::Circuit TimerCircuit>
+constexpr TimerSetting timerSetting(const uint32_t cyclesPerElapse)
+{
+    // Timer 2 provides two more prescalers than Timer 0 and Timer 1. The clock
+    // select bits of each prescaler equal its index plus one.
+    constexpr bool isTimer2{TimerCircuit == Timer::Circuit::Timer2};
+    constexpr uint16_t prescalers[]{1U, 8U, 32U, 64U, 128U, 256U, 1024U};
+    constexpr uint16_t prescalersNoTimer2[]{1U, 8U, 64U, 256U, 1024U};
+    constexpr uint8_t prescalerCount{isTimer2 ? 7U : 5U};
+    constexpr uint32_t maxCyclesPerInterrupt{TimerCircuit == Timer::Circuit::Timer1 ?
+                                             65536UL : 256UL};
+    TimerSetting best{};
+    if (cyclesPerElapse == 0U) { return best; }
+
+    for (uint8_t i{}; i < prescalerCount; ++i)
+    {
+        const uint16_t prescaler{isTimer2 ? prescalers[i] : prescalersNoTimer2[i]};
+        if (cyclesPerElapse % prescaler != 0U) { continue; }
+        const uint32_t timerCycles{cyclesPerElapse / prescaler};
+
+        // Find the fewest interrupts dividing the elapse time into equal periods
+        // the compare register can hold.
+        for (uint32_t count{(timerCycles + maxCyclesPerInterrupt - 1U) / maxCyclesPerInterrupt};
+             count <= timerCycles; ++count)
+        {
+            if (timerCycles % count != 0U) { continue; }
+            if (best.maxCount == 0U || count < best.maxCount)
+            {
+                best = TimerSetting{prescaler, static_cast<uint8_t>(i + 1U),
+                                    static_cast<uint16_t>(timerCycles / count - 1U), count};
+            }
+            break;
+        }
+    }
+    return best;
+}
+
+// -----------------------------------------------------------------------------
+template <Timer::Circuit TimerCircuit>
+constexpr Timer::HardwareConfig hardwareConfig(const TimerSetting& setting)
+{
+    if constexpr (TimerCircuit == Timer::Circuit::Timer0)
+    {
+        return Timer::HardwareConfig{(1 << WGM01), setting.clockSelect,
+                                     setting.compareValue, OCIE0A};
+    }
+    else if constexpr (TimerCircuit == Timer::Circuit::Timer1)
+    {
+        return Timer::HardwareConfig{0x00, static_cast<uint8_t>((1 << WGM12) | setting.clockSelect),
+                                     setting.compareValue, OCIE1A};
+    }
+    else
+    {
+        return Timer::HardwareConfig{(1 << WGM21), setting.clockSelect,
+                                     setting.compareValue, OCIE2A};
+    }
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <Timer::Circuit TimerCircuit, uint16_t ElapseTimeMs>
+StaticTimer<TimerCircuit, ElapseTimeMs>::StaticTimer(const bool startTimer)
+    : Timer{TimerCircuit, Config, MaxCount, ElapseTimeMs, startTimer} {}
+
+} // namespace driver
@@ -0,0 +1,328 @@
+/********************************************************************************
+ * @brief Implementation of fixed-capacity vectors of any data type.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+
+#include "vector.h"
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of fixed-capacity vectors. The elements are
+ *        stored inline, so the vector never allocates heap memory, while its
+ *        size can vary between 0 and the specified capacity.
+ *
+ * @tparam T        The data type of the vector.
+ * @tparam Capacity The maximum number of elements the vector can hold.
+ *
+ * @note The capacity must exceed 0, else a compilation error will be generated.
+ *
+ *       Elements are constructed in place when added and destroyed when
+ *       removed, the unused capacity holds no objects. The data type therefore
+ *       doesn't need a default constructor unless the vector is resized.
+ ********************************************************************************/
+template <typename T, size_t Capacity>
+class StaticVector
+{
+public:
+    using Iterator = typename Vector<T>::Iterator;
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /********************************************************************************
+     * @brief Creates empty vector.
+     ********************************************************************************/
+    StaticVector();
+
+    /********************************************************************************
+     * @brief Creates vector of specified size.
+     *
+     * @param size The size of the vector, i.e. the number of elements it holds.
+     *             The size is limited to the capacity of the vector.
+     ********************************************************************************/
+    StaticVector(const size_t size);
+
+    /********************************************************************************
+     * @brief Creates vector containing specified values.
+     *
+     * @tparam Values Parameter pack containing values.
+     *
+     * @param values The values to add to the vector.
+     *
+     * @note The number of values cannot exceed the capacity of the vector, else a
+     *       compilation error will be generated.
+     ********************************************************************************/
+    template <typename... Values>
+    StaticVector(const Values&&... values);
+
+    /********************************************************************************
+     * @brief Creates vector as a copy of referenced source.
+     *
+     * @param source Reference to vector whose content is copied to the new vector.
+     ********************************************************************************/
+    StaticVector(const StaticVector& source);
+
+    /********************************************************************************
+     * @brief Creates vector by moving the elements of referenced source. The
+     *        source vector is emptied after the move operation is performed.
+     *
+     * @param source Reference to vector whose content is moved to the new vector.
+     ********************************************************************************/
+    StaticVector(StaticVector&& source);
+
+    /********************************************************************************
+     * @brief Destroys the elements before deletion.
+     ********************************************************************************/
+    ~StaticVector();
+
+    /********************************************************************************
+     * @brief Copies the content of referenced source to assigned vector. Previous
+     *        values are cleared before copying.
+     *
+     * @param source Reference to vector whose content is copied.
+     *
+     * @return A reference to the assigned vector.
+     ********************************************************************************/
+    StaticVector& operator=(const StaticVector& source);
+
+    /********************************************************************************
+     * @brief Moves the elements of referenced source to assigned vector. Previous
+     *        values are cleared and the source vector is emptied after the move
+     *        operation is performed.
+     *
+     * @param source Reference to vector whose content is moved.
+     *
+     * @return A reference to the assigned vector.
+     ********************************************************************************/
+    StaticVector& operator=(StaticVector&& source);
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified index in the vector.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return A reference to the element at specified index.
+     ********************************************************************************/
+    T& operator[](const size_t index);
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified index in the vector.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return A reference to the element at specified index.
+     ********************************************************************************/
+    const T& operator[](const size_t index) const;
+
+    /********************************************************************************
+     * @brief Copies referenced values to assigned vector. Previous values are
+     *        cleared before copying.
+     *
+     * @tparam NumValues The number of values to copy.
+     *
+     * @param values Reference to the values to copy.
+     *
+     * @note The number of values cannot exceed the capacity of the vector, else a
+     *       compilation error will be generated.
+     ********************************************************************************/
+    template <size_t NumValues>
+    void operator=(const T (&values)[NumValues]);
+
+    /********************************************************************************
+     * @brief Pushes referenced values to the back of the vector.
+     *
+     * @tparam NumValues The number of values to add.
+     *
+     * @param values Reference to the values to add.
+     *
+     * @return True if the values were added, false if the capacity of the vector
+     *         would be exceeded.
+     ********************************************************************************/
+    template <size_t NumValues>
+    bool operator+=(const T (&values)[NumValues]);
+
+    /********************************************************************************
+     * @brief Provides the data held by the vector.
+     *
+     * @return Pointer to the start address of the vector.
+     ********************************************************************************/
+    T* data();
+
+    /********************************************************************************
+     * @brief Provides the data held by the vector.
+     *
+     * @return Pointer to the start address of the vector.
+     ********************************************************************************/
+    const T* data() const;
+
+    /********************************************************************************
+     * @brief Returns the size of the vector in the number of elements it holds.
+     *
+     * @return The size of the vector as an unsigned integer.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Returns the capacity of the vector, i.e. the maximum number of
+     *        elements it can hold.
+     *
+     * @return The capacity of the vector as an unsigned integer.
+     ********************************************************************************/
+    static constexpr size_t capacity();
+
+    /********************************************************************************
+     * @brief Indicates if the vector is empty.
+     *
+     * @return True if the vector is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Indicates if the vector is full.
+     *
+     * @return True if the vector holds as many elements as its capacity,
+     *         else false.
+     ********************************************************************************/
+    bool full() const;
+
+    /********************************************************************************
+     * @brief Provides the start address of the vector.
+     *
+     * @return Iterator pointing at the start address of the the vector.
+     ********************************************************************************/
+    Iterator begin();
+
+    /********************************************************************************
+     * @brief Provides the start address of the vector.
+     *
+     * @return Iterator pointing at the start address of the the vector.
+     ********************************************************************************/
+    ConstIterator begin() const;
+
+    /********************************************************************************
+     * @brief Provides the end address of the vector.
+     *
+     * @return Iterator pointing at the end address of the the vector.
+     ********************************************************************************/
+    Iterator end();
+
+    /********************************************************************************
+     * @brief Provides the end address of the vector.
+     *
+     * @return Iterator pointing at the end address of the the vector.
+     ********************************************************************************/
+    ConstIterator end() const;
+
+    /********************************************************************************
+     * @brief Provides the reverse start address of the the vector.
+     *
+     * @return Iterator pointing at the reverse start address of the the vector.
+     ********************************************************************************/
+    Iterator rbegin();
+
+    /********************************************************************************
+     * @brief Provides the reverse start address of the the vector.
+     *
+     * @return Iterator pointing at the reverse start address of the the vector.
+     ********************************************************************************/
+    ConstIterator rbegin() const;
+
+    /********************************************************************************
+     * @brief Provides the reverse end address of the the vector.
+     *
+     * @return Iterator pointing at the reverse end address of the the vector.
+     ********************************************************************************/
+    Iterator rend();
+
+    /********************************************************************************
+     * @brief Provides the reverse end address of the the vector.
+     *
+     * @return Iterator pointing at the reverse end address of the the vector.
+     ********************************************************************************/
+    ConstIterator rend() const;
+
+    /********************************************************************************
+     * @brief Returns the address of the last element of the vector.
+     *
+     * @return Pointer to the last element of the vector.
+     ********************************************************************************/
+    T* last();
+
+    /********************************************************************************
+     * @brief Returns the address of the last element of the vector.
+     *
+     * @return Pointer to the last element of the vector.
+     ********************************************************************************/
+    const T* last() const;
+
+    /********************************************************************************
+     * @brief Clears content of the vector, the elements are destroyed.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Resizes the vector to specified new size. Added elements are
+     *        value-initialized and removed elements are destroyed.
+     *
+     * @param newSize The new size of the vector.
+     *
+     * @return True if the vector was resized, false if the new size exceeds the
+     *         capacity of the vector.
+     ********************************************************************************/
+    bool resize(const size_t newSize);
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of the vector.
+     *
+     * @param value Reference to the new value to push to the vector.
+     *
+     * @return True if the value was pushed to the back of the vector, false if
+     *         the vector is full.
+     ********************************************************************************/
+    bool pushBack(const T& value);
+
+    /********************************************************************************
+     * @brief Moves new value to the back of the vector.
+     *
+     * @param value Reference to the new value to move to the vector.
+     *
+     * @return True if the value was pushed to the back of the vector, false if
+     *         the vector is full.
+     ********************************************************************************/
+    bool pushBack(T&& value);
+
+    /********************************************************************************
+     * @brief Creates new value at the back of the vector.
+     *
+     * @tparam Args Parameter pack containing the constructor arguments.
+     *
+     * @param args The arguments passed to the constructor of the new value.
+     *
+     * @return True if the value was created at the back of the vector, false if
+     *         the vector is full.
+     ********************************************************************************/
+    template <typename... Args>
+    bool emplaceBack(Args&&... args);
+
+    /********************************************************************************
+     * @brief Pops value at the back of the vector, the value is destroyed.
+     *
+     * @return True if the last value of the vector was popped, false if the
+     *         vector is empty.
+     ********************************************************************************/
+    bool popBack();
+
+protected:
+    static_assert(Capacity > 0, "Static vector capacity cannot be set to 0!");
+    template <size_t NumValues>
+    bool addValues(const T (&values)[NumValues]);
+
+    // Storage of the elements, whose lifetime is managed by the vector.
+    union { T myData[Capacity]; };
+    size_t mySize{};
+};
+
+} // namespace container
+
+#include "static_vector_impl.h"
\ No newline at end of file
@@ -0,0 +1,274 @@
+/********************************************************************************
+ * @brief Implementation details for the container::StaticVector class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+#include "utils.h"
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::StaticVector() {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::StaticVector(const size_t size)
+{
+    resize(size < Capacity ? size : Capacity);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <typename... Values>
+StaticVector<T, Capacity>::StaticVector(const Values&&... values)
+{
+    static_assert(sizeof...(values) <= Capacity,
+        "Number of values exceeds the static vector capacity!");
+    const T array[sizeof...(values)]{(values)...};
+    addValues(array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::StaticVector(const StaticVector& source)
+{
+    for (const auto& value : source) { utils::construct(myData + mySize++, value); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::StaticVector(StaticVector&& source)
+{
+    for (auto& value : source) { utils::construct(myData + mySize++, utils::move(value)); }
+    source.clear();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::~StaticVector() { clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>& StaticVector<T, Capacity>::operator=(const StaticVector& source)
+{
+    if (&source != this)
+    {
+        clear();
+        for (const auto& value : source) { utils::construct(myData + mySize++, value); }
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>& StaticVector<T, Capacity>::operator=(StaticVector&& source)
+{
+    if (&source != this)
+    {
+        clear();
+        for (auto& value : source) { utils::construct(myData + mySize++, utils::move(value)); }
+        source.clear();
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+T& StaticVector<T, Capacity>::operator[](const size_t index) { return myData[index]; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+const T& StaticVector<T, Capacity>::operator[](const size_t index) const
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <size_t NumValues>
+void StaticVector<T, Capacity>::operator=(const T (&values)[NumValues])
+{
+    static_assert(NumValues <= Capacity,
+        "Number of values exceeds the static vector capacity!");
+    clear();
+    addValues(values);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <size_t NumValues>
+bool StaticVector<T, Capacity>::operator+=(const T (&values)[NumValues])
+{
+    static_assert(NumValues <= Capacity,
+        "Number of values exceeds the static vector capacity!");
+    return addValues(values);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+T* StaticVector<T, Capacity>::data() { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+const T* StaticVector<T, Capacity>::data() const { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+size_t StaticVector<T, Capacity>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+constexpr size_t StaticVector<T, Capacity>::capacity() { return Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::full() const { return mySize == Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::begin()
+{
+    return Iterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator StaticVector<T, Capacity>::begin() const
+{
+    return ConstIterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::end()
+{
+    return Iterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator StaticVector<T, Capacity>::end() const
+{
+    return ConstIterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::rbegin()
+{
+    return mySize > 0 ? Iterator{myData + mySize - 1} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator StaticVector<T, Capacity>::rbegin() const
+{
+    return mySize > 0 ? ConstIterator{myData + mySize - 1} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::rend()
+{
+    return mySize > 0 ? Iterator{myData - 1} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator StaticVector<T, Capacity>::rend() const
+{
+    return mySize > 0 ? ConstIterator{myData - 1} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+T* StaticVector<T, Capacity>::last() { return mySize > 0 ? myData + mySize - 1 : nullptr; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+const T* StaticVector<T, Capacity>::last() const
+{
+    return mySize > 0 ? myData + mySize - 1 : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+void StaticVector<T, Capacity>::clear() 
+{
+    while (mySize > 0) { myData[--mySize].~T(); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::resize(const size_t newSize)
+{
+    if (newSize > Capacity) { return false; }
+    while (mySize > newSize) { myData[--mySize].~T(); }
+    while (mySize < newSize) { utils::construct(myData + mySize++); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::pushBack(const T& value)
+{
+    if (full()) { return false; }
+    utils::construct(myData + mySize++, value);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::pushBack(T&& value)
+{
+    if (full()) { return false; }
+    utils::construct(myData + mySize++, utils::move(value));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <typename... Args>
+bool StaticVector<T, Capacity>::emplaceBack(Args&&... args)
+{
+    if (full()) { return false; }
+    utils::construct(myData + mySize++, utils::forward<Args>(args)...);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::popBack()
+{
+    if (empty()) { return false; }
+    myData[--mySize].~T();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <size_t NumValues>
+bool StaticVector<T, Capacity>::addValues(const T (&values)[NumValues])
+{
+    if (mySize + NumValues > Capacity) { return false; }
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        utils::copyElements(myData + mySize, values, NumValues);
+        mySize += NumValues;
+    }
+    else
+    {
+        for (const auto& value : values) { utils::construct(myData + mySize++, value); }
+    }
+    return true;
+}
+
+} // namespace container
\ No newline at end of file
@@ -1,163 +1,308 @@
-/********************************************************************************
- * @brief Implementation type traits for static checking of data types.
- ********************************************************************************/
-#pragma once
-
-#include <stdint.h>
-
-namespace type_traits 
-{
-
-/********************************************************************************
- * @brief Indicates if specified type T is of unsigned integral type.
- *
- * @param value Constant set to true for unsigned integral types, 
- *              false for everything else.
- ********************************************************************************/
-template <typename T>
-struct is_unsigned 
-{
-	static const bool value{false};
-};
-
-/********************************************************************************
- * @brief Declares uint8_t as a valid unsigned integral type.
- ********************************************************************************/
-template <>
-struct is_unsigned<uint8_t> 
-{
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares uint16_t as a valid unsigned integral type.
- ********************************************************************************/
-template <>
-struct is_unsigned<uint16_t> 
-{
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares uint32_t as a valid unsigned integral type.
- ********************************************************************************/
-template <>
-struct is_unsigned<uint32_t> 
-{
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares uint64_t as a valid unsigned integral type.
- ********************************************************************************/
-template <>
-struct is_unsigned<uint64_t> 
-{
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Indicates if specified type T is of signed integral type.
- *
- * @param value Constant set to true for signed integral types, 
- *              false for everything else.
- ********************************************************************************/
-template <typename T>
-struct is_signed 
-{
-	static const bool value{false};
-};
-
-/********************************************************************************
- * @brief Declares int8_t as a valid signed integral type.
- ********************************************************************************/
-template <>
-struct is_signed<int8_t> 
-{
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares int16_t as a valid signed integral type.
- ********************************************************************************/
-template <>
-struct is_signed<int16_t> 
-{
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares int32_t as a valid signed integral type.
- ********************************************************************************/
-template <>
-struct is_signed<int32_t> 
-{
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares int64_t as a valid signed integral type.
- ********************************************************************************/
-template <>
-struct is_signed<int64_t> 
-{
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Indicates if specified type T is of integral type, which encompasses
- *        both signed and unsigned integers.
- *
- * @param value Constant set to true for integral types, false for 
- *              everything else.
- ********************************************************************************/
-template <typename T>
-struct is_integral 
-{
-    static const bool value{is_unsigned<T>::value || is_signed<T>::value};
-};
-
-/********************************************************************************
- * @brief Indicates if specified type T is of floating-point type.
- *
- * @param value Constant set to true for floating-point types, false for
- *              everything else.
- ********************************************************************************/
-template <typename T>
-struct is_floating_point 
-{
-	static const bool value{false};
-};
-
-/********************************************************************************
- * @brief Declares float as a valid floating-point type.
- ********************************************************************************/
-template <>
-struct is_floating_point<float> 
-{
-    static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares double as a valid floating-point type.
- ********************************************************************************/
-template <>
-struct is_floating_point<double> 
-{
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Indicates if specified type T is of arithmetic type, i.e. integral
- *        or floating-point type.
- *
- * @param value Constant set to true for arithmetic types, false for
- *              everything else.
- ********************************************************************************/
-template <typename T>
-struct is_arithmetic 
-{
-    static const bool value{is_integral<T>::value || is_floating_point<T>::value};
-};
-
-} // namespace type_traits
+/********************************************************************************
+ * @brief Implementation type traits for static checking of data types.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace type_traits 
+{
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of unsigned integral type.
+ *
+ * @param value Constant set to true for unsigned integral types, 
+ *              false for everything else.
+ ********************************************************************************/
+template <typename T>
+struct is_unsigned 
+{
+	static const bool value{false};
+};
+
+/********************************************************************************
+ * @brief Declares uint8_t as a valid unsigned integral type.
+ ********************************************************************************/
+template <>
+struct is_unsigned<uint8_t> 
+{
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares uint16_t as a valid unsigned integral type.
+ ********************************************************************************/
+template <>
+struct is_unsigned<uint16_t> 
+{
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares uint32_t as a valid unsigned integral type.
+ ********************************************************************************/
+template <>
+struct is_unsigned<uint32_t> 
+{
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares uint64_t as a valid unsigned integral type.
+ ********************************************************************************/
+template <>
+struct is_unsigned<uint64_t> 
+{
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of signed integral type.
+ *
+ * @param value Constant set to true for signed integral types, 
+ *              false for everything else.
+ ********************************************************************************/
+template <typename T>
+struct is_signed 
+{
+	static const bool value{false};
+};
+
+/********************************************************************************
+ * @brief Declares int8_t as a valid signed integral type.
+ ********************************************************************************/
+template <>
+struct is_signed<int8_t> 
+{
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares int16_t as a valid signed integral type.
+ ********************************************************************************/
+template <>
+struct is_signed<int16_t> 
+{
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares int32_t as a valid signed integral type.
+ ********************************************************************************/
+template <>
+struct is_signed<int32_t> 
+{
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares int64_t as a valid signed integral type.
+ ********************************************************************************/
+template <>
+struct is_signed<int64_t> 
+{
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of integral type, which encompasses
+ *        both signed and unsigned integers.
+ *
+ * @param value Constant set to true for integral types, false for 
+ *              everything else.
+ ********************************************************************************/
+template <typename T>
+struct is_integral 
+{
+    static const bool value{is_unsigned<T>::value || is_signed<T>::value};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of floating-point type.
+ *
+ * @param value Constant set to true for floating-point types, false for
+ *              everything else.
+ ********************************************************************************/
+template <typename T>
+struct is_floating_point 
+{
+	static const bool value{false};
+};
+
+/********************************************************************************
+ * @brief Declares float as a valid floating-point type.
+ ********************************************************************************/
+template <>
+struct is_floating_point<float> 
+{
+    static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares double as a valid floating-point type.
+ ********************************************************************************/
+template <>
+struct is_floating_point<double> 
+{
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of arithmetic type, i.e. integral
+ *        or floating-point type.
+ *
+ * @param value Constant set to true for arithmetic types, false for
+ *              everything else.
+ ********************************************************************************/
+template <typename T>
+struct is_arithmetic 
+{
+    static const bool value{is_integral<T>::value || is_floating_point<T>::value};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is trivially copyable, i.e. if instances
+ *        can be copied byte by byte, for instance via memcpy.
+ *
+ * @param value Constant set to true for trivially copyable types, false for
+ *              everything else.
+ ********************************************************************************/
+template <typename T>
+struct is_trivially_copyable 
+{
+    static const bool value{__is_trivially_copyable(T)};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified types T and U are the same type.
+ *
+ * @param value Constant set to true if T and U are the same type, false for
+ *              everything else.
+ ********************************************************************************/
+template <typename T, typename U>
+struct is_same 
+{
+    static const bool value{false};
+};
+
+/********************************************************************************
+ * @brief Declares that a type is the same as itself.
+ ********************************************************************************/
+template <typename T>
+struct is_same<T, T> 
+{
+    static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Provides type T if specified condition is true, else no type. Used to
+ *        remove function overloads at compile time, for instance
+ *
+ *            template <typename T>
+ *            typename enable_if<is_integral<T>::value>::type print(const T value);
+ *
+ * @param type Type T if the condition is true, undefined otherwise.
+ ********************************************************************************/
+template <bool Condition, typename T = void>
+struct enable_if {};
+
+/********************************************************************************
+ * @brief Provides type T since the condition is true.
+ ********************************************************************************/
+template <typename T>
+struct enable_if<true, T> 
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Selects type T if specified condition is true, else type F.
+ *
+ * @param type Type T if the condition is true, type F otherwise.
+ ********************************************************************************/
+template <bool Condition, typename T, typename F>
+struct conditional 
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Selects type F since the condition is false.
+ ********************************************************************************/
+template <typename T, typename F>
+struct conditional<false, T, F> 
+{
+    typedef F type;
+};
+
+/********************************************************************************
+ * @brief Provides type T unchanged. Used to exclude function parameters from
+ *        template argument deduction, so that their arguments are converted to
+ *        the type deduced from the other parameters.
+ *
+ * @param type Type T.
+ ********************************************************************************/
+template <typename T>
+struct type_identity
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Provides type T without top-level const and volatile qualifiers.
+ *
+ * @param type Type T without const and volatile qualifiers.
+ ********************************************************************************/
+template <typename T>
+struct remove_cv
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Removes the const qualifier of type T.
+ ********************************************************************************/
+template <typename T>
+struct remove_cv<const T>
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Removes the volatile qualifier of type T.
+ ********************************************************************************/
+template <typename T>
+struct remove_cv<volatile T>
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Removes the const and volatile qualifiers of type T.
+ ********************************************************************************/
+template <typename T>
+struct remove_cv<const volatile T>
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Indicates if the calling function is evaluated at compile time, e.g.
+ *        while initializing a constexpr variable. Used to choose between
+ *        implementations that are only valid at compile time or at runtime.
+ *
+ * @return True if the call is evaluated at compile time, else false.
+ *
+ * @note Compilers without support for this check (GCC older than 9) always
+ *       get true, so the implementation valid at compile time is chosen.
+ ********************************************************************************/
+constexpr bool is_constant_evaluated()
+{
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+} // namespace type_traits
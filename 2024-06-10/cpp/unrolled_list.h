@@ -0,0 +1,504 @@
+/********************************************************************************
+ * @brief Implementation of unrolled linked lists of any data type.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "allocation.h"
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of unrolled linked lists. The list provides
+ *        the same interface as container::List, but each node holds up to
+ *        NodeCapacity elements instead of one. The node pointers and the
+ *        allocation overhead are therefore shared by several elements, which
+ *        for small elements such as uint8_t reduces both the memory overhead
+ *        and the number of allocations by roughly a factor NodeCapacity.
+ *        Elements stored in the same node are also contiguous in memory.
+ *
+ *        Full nodes are split in half when a value is inserted, and sparse
+ *        nodes are merged with their successor when a value is removed, so
+ *        the nodes stay at least partially filled.
+ *
+ * @tparam T            The list type.
+ * @tparam NodeCapacity The maximum number of elements per node (default = 8).
+ * @tparam Allocation   Allocation policy used for the list nodes, see
+ *                      allocation.h (default = allocation::Heap, i.e. each node
+ *                      is allocated separately on the heap). All lists of the
+ *                      same type share the same node allocator.
+ *
+ * @note The node capacity must be in the range 2 - 255, else a compilation error
+ *       will be generated. Inserting or removing values moves the subsequent
+ *       elements of the same node, which invalidates iterators pointing at them,
+ *       except for the iterator passed to insert or remove.
+ ********************************************************************************/
+template <typename T, size_t NodeCapacity = 8, typename Allocation = allocation::Heap>
+class UnrolledList
+{
+public:
+    class Iterator;
+    class ConstIterator;
+
+    /********************************************************************************
+     * @brief Creates empty list.
+     ********************************************************************************/
+    UnrolledList();
+
+    /********************************************************************************
+     * @brief Creates list of specified size initialized with specified start value.
+     *
+     * @param size       The starting size of the list.
+     * @param startValue The starting value for each element (default = 0).
+     ********************************************************************************/
+    UnrolledList(const size_t size, const T& startValue = static_cast<T>(0));
+
+    /********************************************************************************
+     * @brief Creates list initialized with values passed as input arguments.
+     *
+     * @tparam Values... Parameter pack holding input arguments.
+     *
+     * @param values The arguments to store in newly created list.
+     ********************************************************************************/
+    template <typename... Values>
+    UnrolledList(const Values&&... values);
+
+    /********************************************************************************
+     * @brief Creates new list as a copy of referenced source.
+     *
+     * @param source Reference to list whose content is copied to the new list.
+     ********************************************************************************/
+    UnrolledList(const UnrolledList& source);
+
+    /********************************************************************************
+     * @brief Moves memory from referenced source to the new list. The source
+     *        list is emptied after the move operation is performed.
+     *
+     * @param source Reference to list whose content is moved to the new list.
+     ********************************************************************************/
+    UnrolledList(UnrolledList&& source);
+
+    /********************************************************************************
+     * @brief Deletes list.
+     ********************************************************************************/
+    ~UnrolledList();
+
+    /********************************************************************************
+     * @brief Returns reference to the value at specified position in the list.
+     *
+     * @param iterator Reference to iterator pointing at the value to read.
+     *
+     * @return A reference to the element at specified position.
+     ********************************************************************************/
+    T& operator[](Iterator& iterator);
+
+    /********************************************************************************
+     * @brief Returns reference to the value at specified position in the list.
+     *
+     * @param iterator Reference to iterator pointing at the value to read.
+     *
+     * @return A reference to the element at specified position.
+     ********************************************************************************/
+    const T& operator[](ConstIterator& iterator) const;
+
+    /********************************************************************************
+     * @brief Moves memory from referenced source to assigned list. Previous
+     *        values are cleared and the source list is emptied after the move
+     *        operation is performed.
+     *
+     * @param source Reference to list whose content is moved to assigned list.
+     ********************************************************************************/
+    void operator=(UnrolledList&& source);
+
+    /********************************************************************************
+     * @brief Pushes values to the back of the list.
+     *
+     * @tparam NumValues The number of values to add.
+     *
+     * @param values Reference to the values to add.
+     *
+     * @return True if the values were added, else false.
+     ********************************************************************************/
+    template <size_t NumValues>
+    bool operator+=(const T (&values)[NumValues]);
+
+    /********************************************************************************
+     * @brief Returns the size of the list.
+     *
+     * @return The size of the list in the number of element it holds.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Returns the number of nodes allocated by the list.
+     *
+     * @return The number of nodes as an unsigned integer.
+     ********************************************************************************/
+    size_t numNodes() const;
+
+    /********************************************************************************
+     * @brief Clears the list.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Indicates if the list is empty.
+     *
+     * @return True if the list is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Provides the start address of the list.
+     *
+     * @return Iterator pointing at the first element of the list.
+     ********************************************************************************/
+    Iterator begin();
+
+    /********************************************************************************
+     * @brief Provides the start address of the list.
+     *
+     * @return Iterator pointing at the first element of the list.
+     ********************************************************************************/
+    ConstIterator begin() const;
+
+    /********************************************************************************
+     * @brief Provides the end address of the list.
+     *
+     * @return Iterator pointing at the end of the list.
+     ********************************************************************************/
+    Iterator end();
+
+    /********************************************************************************
+     * @brief Provides the end address of the list.
+     *
+     * @return Iterator pointing at the end of the list.
+     ********************************************************************************/
+    ConstIterator end() const;
+
+    /********************************************************************************
+     * @brief Provides the reverse start address of the list.
+     *
+     * @return Iterator pointing at the last element of the list.
+     ********************************************************************************/
+    Iterator rbegin();
+
+    /********************************************************************************
+     * @brief Provides the reverse start address of the list.
+     *
+     * @return Iterator pointing at the last element of the list.
+     ********************************************************************************/
+    ConstIterator rbegin() const;
+
+    /********************************************************************************
+     * @brief Provides the reverse end address of the list.
+     *
+     * @return Iterator pointing at the reverse end of the list.
+     ********************************************************************************/
+    Iterator rend();
+
+    /********************************************************************************
+     * @brief Provides the reverse end address of the list.
+     *
+     * @return Iterator pointing at the reverse end of the list.
+     ********************************************************************************/
+    ConstIterator rend() const;
+
+    /********************************************************************************
+     * @brief Resizes the list to specified new size. Values are added or removed
+     *        at the back of the list.
+     *
+     * @param newSize    The new size of the list.
+     * @param startValue The starting value for each new element (default = 0).
+     *
+     * @return True if the list was resized, else false.
+     ********************************************************************************/
+    bool resize(const size_t newSize, const T& startValue = static_cast<T>(0));
+
+    /********************************************************************************
+     * @brief Inserts value at the front of the list.
+     *
+     * @param value Reference to the value to add.
+     *
+     * @return True if the value was added, else false.
+     ********************************************************************************/
+    bool pushFront(const T& value);
+
+    /********************************************************************************
+     * @brief Inserts value at the back of the list.
+     *
+     * @param value Reference to the value to add.
+     *
+     * @return True if the value was added, else false.
+     ********************************************************************************/
+    bool pushBack(const T& value);
+
+    /********************************************************************************
+     * @brief Constructs value at the front of the list.
+     *
+     * @tparam Args Parameter pack containing the constructor arguments.
+     *
+     * @param args The arguments passed to the constructor of the new value.
+     *
+     * @return True if the value was added, else false.
+     ********************************************************************************/
+    template <typename... Args>
+    bool emplaceFront(Args&&... args);
+
+    /********************************************************************************
+     * @brief Constructs value at the back of the list.
+     *
+     * @tparam Args Parameter pack containing the constructor arguments.
+     *
+     * @param args The arguments passed to the constructor of the new value.
+     *
+     * @return True if the value was added, else false.
+     ********************************************************************************/
+    template <typename... Args>
+    bool emplaceBack(Args&&... args);
+
+    /********************************************************************************
+     * @brief Inserts value at specified position in the list.
+     *
+     * @param iterator Reference to iterator pointing at the location to place
+     *                 the new value. The iterator keeps pointing at the same
+     *                 element, which is now placed after the new value.
+     * @param value    Reference to the value to add.
+     *
+     * @return True if the value was added, else false.
+     ********************************************************************************/
+    bool insert(Iterator& iterator, const T& value);
+
+    /********************************************************************************
+     * @brief Removes value at the front of the list.
+     ********************************************************************************/
+    void popFront();
+
+    /********************************************************************************
+     * @brief Removes value at the back of the list.
+     ********************************************************************************/
+    void popBack();
+
+    /********************************************************************************
+     * @brief Removes value at specified position in the list.
+     *
+     * @param iterator Reference to iterator pointing at the value to remove. The
+     *                 iterator is set to point at the element after the removed
+     *                 value, so elements can be removed while iterating.
+     *
+     * @return True if the value was removed, else false.
+     ********************************************************************************/
+    bool remove(Iterator& iterator);
+
+private:
+    static_assert(NodeCapacity >= 2 && NodeCapacity <= UINT8_MAX,
+        "Unrolled list node capacity must be in the range 2 - 255!");
+    struct Node;
+
+    bool copy(const UnrolledList& source);
+    template <size_t NumValues>
+    bool addValues(const T (&values)[NumValues]);
+    Node* createNode(Node* previous, Node* next);
+    void destroyNode(Node* node);
+    void mergeWithNext(Node* node);
+    static void shiftRight(Node* node, const size_t index);
+    static void shiftLeft(Node* node, const size_t index);
+
+    using NodeAllocator = typename Allocation::template Allocator<Node>;
+    static NodeAllocator myNodeAllocator;
+
+    Node* myFirst{nullptr};
+    Node* myLast{nullptr};
+    size_t mySize{};
+    size_t myNumNodes{};
+};
+
+/********************************************************************************
+ * @brief Implementation of mutable unrolled list iterators.
+ *
+ * @tparam T            The data type of the list.
+ * @tparam NodeCapacity The maximum number of elements per node.
+ * @tparam Allocation   Allocation policy used for the list nodes.
+ ********************************************************************************/
+template <typename T, size_t NodeCapacity, typename Allocation>
+class UnrolledList<T, NodeCapacity, Allocation>::Iterator
+{
+public:
+    /********************************************************************************
+     * @brief Creates empty iterator.
+     ********************************************************************************/
+    Iterator();
+
+    /********************************************************************************
+     * @brief Creates iterator pointing at specified element of referenced node.
+     *
+     * @param node  Pointer to node holding the element.
+     * @param index Index of the element within the node (default = 0).
+     ********************************************************************************/
+    Iterator(Node* node, const size_t index = 0);
+
+    /********************************************************************************
+     * @brief Prefix increment operator, sets the iterator to point at next element.
+     ********************************************************************************/
+    void operator++();
+
+    /********************************************************************************
+     * @brief Postfix increment operator, sets the iterator to point at next element.
+     ********************************************************************************/
+    void operator++(int);
+
+    /********************************************************************************
+     * @brief Prefix decrement operator, sets the iterator to point at previous
+     *        element.
+     ********************************************************************************/
+    void operator--();
+
+    /********************************************************************************
+     * @brief Postfix decrement operator, sets the iterator to point at previous
+     *        element.
+     ********************************************************************************/
+    void operator--(int);
+
+    /********************************************************************************
+     * @brief Addition operator, increments the iterator specified number of times.
+     *
+     * @param numIncrements The number of times the iterator will be incremented.
+     ********************************************************************************/
+    void operator+=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Subtraction operator, decrements the iterator specified number of
+     *        times.
+     *
+     * @param numIncrements The number of times the iterator will be decremented.
+     ********************************************************************************/
+    void operator-=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Equality operator, checks if the iterator points at the same element
+     *        as referenced other iterator.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same element, else false.
+     ********************************************************************************/
+    bool operator==(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Inequality operator, checks if the iterator and referenced other
+     *        iterator point at different elements.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at different elements, else false.
+     ********************************************************************************/
+    bool operator!=(const Iterator& other) const;
+
+    /********************************************************************************
+     * @brief Dereference operator, provides a reference to the element the
+     *        iterator is pointing at.
+     *
+     * @return Reference to the element the iterator is pointing at.
+     ********************************************************************************/
+    T& operator*();
+
+private:
+    friend class UnrolledList;
+    Node* myNode{nullptr};
+    size_t myIndex{};
+};
+
+/********************************************************************************
+ * @brief Implementation of constant unrolled list iterators.
+ *
+ * @tparam T            The data type of the list.
+ * @tparam NodeCapacity The maximum number of elements per node.
+ * @tparam Allocation   Allocation policy used for the list nodes.
+ ********************************************************************************/
+template <typename T, size_t NodeCapacity, typename Allocation>
+class UnrolledList<T, NodeCapacity, Allocation>::ConstIterator
+{
+public:
+    /********************************************************************************
+     * @brief Creates iterator pointing at specified element of referenced node.
+     *
+     * @param node  Pointer to node holding the element.
+     * @param index Index of the element within the node (default = 0).
+     ********************************************************************************/
+    ConstIterator(const Node* node, const size_t index = 0);
+
+    /********************************************************************************
+     * @brief Prefix increment operator, sets the iterator to point at next element.
+     ********************************************************************************/
+    void operator++();
+
+    /********************************************************************************
+     * @brief Postfix increment operator, sets the iterator to point at next element.
+     ********************************************************************************/
+    void operator++(int);
+
+    /********************************************************************************
+     * @brief Prefix decrement operator, sets the iterator to point at previous
+     *        element.
+     ********************************************************************************/
+    void operator--();
+
+    /********************************************************************************
+     * @brief Postfix decrement operator, sets the iterator to point at previous
+     *        element.
+     ********************************************************************************/
+    void operator--(int);
+
+    /********************************************************************************
+     * @brief Addition operator, increments the iterator specified number of times.
+     *
+     * @param numIncrements The number of times the iterator will be incremented.
+     ********************************************************************************/
+    void operator+=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Subtraction operator, decrements the iterator specified number of
+     *        times.
+     *
+     * @param numIncrements The number of times the iterator will be decremented.
+     ********************************************************************************/
+    void operator-=(const size_t numIncrements);
+
+    /********************************************************************************
+     * @brief Equality operator, checks if the iterator points at the same element
+     *        as referenced other iterator.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same element, else false.
+     ********************************************************************************/
+    bool operator==(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Inequality operator, checks if the iterator and referenced other
+     *        iterator point at different elements.
+     *
+     * @param other Reference to other iterator.
+     *
+     * @return True if the iterators point at different elements, else false.
+     ********************************************************************************/
+    bool operator!=(const ConstIterator& other) const;
+
+    /********************************************************************************
+     * @brief Dereference operator, provides a reference to the element the
+     *        iterator is pointing at.
+     *
+     * @return Reference to the element the iterator is pointing at.
+     ********************************************************************************/
+    const T& operator*() const;
+
+private:
+    const Node* myNode{nullptr};
+    size_t myIndex{};
+};
+
+} // namespace container
+
+#include "unrolled_list_impl.h"
\ No newline at end of file
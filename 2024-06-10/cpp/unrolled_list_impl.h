@@ -0,0 +1,585 @@
+/********************************************************************************
+ * @brief Implementation details for the container::UnrolledList class.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+#include "utils.h"
+
+namespace container
+{
+
+template <typename T, size_t NodeCapacity, typename Allocation>
+struct UnrolledList<T, NodeCapacity, Allocation>::Node
+{
+    Node* previous;
+    Node* next;
+    uint8_t count;
+    T data[NodeCapacity];
+};
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::NodeAllocator
+    UnrolledList<T, NodeCapacity, Allocation>::myNodeAllocator{};
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+UnrolledList<T, NodeCapacity, Allocation>::UnrolledList() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+UnrolledList<T, NodeCapacity, Allocation>::UnrolledList(const size_t size,
+                                                        const T& startValue)
+{
+    resize(size, startValue);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+template <typename... Values>
+UnrolledList<T, NodeCapacity, Allocation>::UnrolledList(const Values&&... values)
+{
+    const T array[sizeof...(values)]{static_cast<T>(values)...};
+    addValues(array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+UnrolledList<T, NodeCapacity, Allocation>::UnrolledList(const UnrolledList& source)
+{
+    copy(source);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+UnrolledList<T, NodeCapacity, Allocation>::UnrolledList(UnrolledList&& source)
+{
+    myFirst = source.myFirst;
+    myLast = source.myLast;
+    mySize = source.mySize;
+    myNumNodes = source.myNumNodes;
+    source.myFirst = nullptr;
+    source.myLast = nullptr;
+    source.mySize = 0;
+    source.myNumNodes = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+UnrolledList<T, NodeCapacity, Allocation>::~UnrolledList() { clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+T& UnrolledList<T, NodeCapacity, Allocation>::operator[](Iterator& iterator)
+{
+    return *iterator;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+const T& UnrolledList<T, NodeCapacity, Allocation>::operator[](ConstIterator& iterator) const
+{
+    return *iterator;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::operator=(UnrolledList&& source)
+{
+    if (&source == this) { return; }
+    clear();
+    myFirst = source.myFirst;
+    myLast = source.myLast;
+    mySize = source.mySize;
+    myNumNodes = source.myNumNodes;
+    source.myFirst = nullptr;
+    source.myLast = nullptr;
+    source.mySize = 0;
+    source.myNumNodes = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+template <size_t NumValues>
+bool UnrolledList<T, NodeCapacity, Allocation>::operator+=(const T (&values)[NumValues])
+{
+    return addValues(values);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+size_t UnrolledList<T, NodeCapacity, Allocation>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+size_t UnrolledList<T, NodeCapacity, Allocation>::numNodes() const { return myNumNodes; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::clear()
+{
+    while (myFirst != nullptr) { destroyNode(myFirst); }
+    mySize = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::Iterator
+    UnrolledList<T, NodeCapacity, Allocation>::begin()
+{
+    return Iterator{myFirst};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::ConstIterator
+    UnrolledList<T, NodeCapacity, Allocation>::begin() const
+{
+    return ConstIterator{myFirst};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::Iterator
+    UnrolledList<T, NodeCapacity, Allocation>::end()
+{
+    return Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::ConstIterator
+    UnrolledList<T, NodeCapacity, Allocation>::end() const
+{
+    return ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::Iterator
+    UnrolledList<T, NodeCapacity, Allocation>::rbegin()
+{
+    return myLast != nullptr ? Iterator{myLast, myLast->count - 1U} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::ConstIterator
+    UnrolledList<T, NodeCapacity, Allocation>::rbegin() const
+{
+    return myLast != nullptr ?
+        ConstIterator{myLast, myLast->count - 1U} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::Iterator
+    UnrolledList<T, NodeCapacity, Allocation>::rend()
+{
+    return Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::ConstIterator
+    UnrolledList<T, NodeCapacity, Allocation>::rend() const
+{
+    return ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::resize(const size_t newSize,
+                                                       const T& startValue)
+{
+    while (mySize < newSize)
+    {
+        if (!pushBack(startValue)) { return false; }
+    }
+    while (mySize > newSize) { popBack(); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::pushFront(const T& value)
+{
+    return emplaceFront(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::pushBack(const T& value)
+{
+    return emplaceBack(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+template <typename... Args>
+bool UnrolledList<T, NodeCapacity, Allocation>::emplaceFront(Args&&... args)
+{
+    if ((myFirst == nullptr || myFirst->count == NodeCapacity) &&
+        createNode(nullptr, myFirst) == nullptr)
+    {
+        return false;
+    }
+    shiftRight(myFirst, 0);
+    myFirst->data[0] = T(utils::forward<Args>(args)...);
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+template <typename... Args>
+bool UnrolledList<T, NodeCapacity, Allocation>::emplaceBack(Args&&... args)
+{
+    if ((myLast == nullptr || myLast->count == NodeCapacity) &&
+        createNode(myLast, nullptr) == nullptr)
+    {
+        return false;
+    }
+    myLast->data[myLast->count++] = T(utils::forward<Args>(args)...);
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::insert(Iterator& iterator, const T& value)
+{
+    auto node{iterator.myNode};
+    auto index{iterator.myIndex};
+    if (node == nullptr) { return false; }
+
+    // Split a full node, where the upper half is moved to a new successor.
+    if (node->count == NodeCapacity)
+    {
+        constexpr size_t half{NodeCapacity / 2};
+        auto next{createNode(node, node->next)};
+        if (next == nullptr) { return false; }
+
+        for (size_t i{half}; i < NodeCapacity; ++i)
+        {
+            next->data[i - half] = utils::move(node->data[i]);
+        }
+        next->count = NodeCapacity - half;
+        node->count = half;
+
+        if (index > half)
+        {
+            node = next;
+            index -= half;
+        }
+    }
+
+    shiftRight(node, index);
+    node->data[index] = value;
+    mySize++;
+    iterator = index + 1 < node->count ? Iterator{node, index + 1} : Iterator{node->next};
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::popFront()
+{
+    if (mySize == 0) { return; }
+    shiftLeft(myFirst, 0);
+    mySize--;
+    if (myFirst->count == 0) { destroyNode(myFirst); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::popBack()
+{
+    if (mySize == 0) { return; }
+    myLast->count--;
+    mySize--;
+    if (myLast->count == 0) { destroyNode(myLast); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::remove(Iterator& iterator)
+{
+    auto node{iterator.myNode};
+    const auto index{iterator.myIndex};
+    if (node == nullptr || index >= node->count) { return false; }
+
+    shiftLeft(node, index);
+    mySize--;
+
+    if (node->count == 0)
+    {
+        auto next{node->next};
+        destroyNode(node);
+        iterator = Iterator{next};
+    }
+    else
+    {
+        mergeWithNext(node);
+        iterator = index < node->count ? Iterator{node, index} : Iterator{node->next};
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::copy(const UnrolledList& source)
+{
+    clear();
+    for (auto i{source.begin()}; i != source.end(); ++i)
+    {
+        if (!pushBack(*i)) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+template <size_t NumValues>
+bool UnrolledList<T, NodeCapacity, Allocation>::addValues(const T (&values)[NumValues])
+{
+    for (size_t i{}; i < NumValues; ++i)
+    {
+        if (!pushBack(values[i])) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+typename UnrolledList<T, NodeCapacity, Allocation>::Node*
+    UnrolledList<T, NodeCapacity, Allocation>::createNode(Node* previous, Node* next)
+{
+    auto node{myNodeAllocator.allocate()};
+    if (node == nullptr) { return nullptr; }
+    utils::construct(node);
+
+    node->previous = previous;
+    node->next = next;
+    if (previous != nullptr) { previous->next = node; }
+    else { myFirst = node; }
+    if (next != nullptr) { next->previous = node; }
+    else { myLast = node; }
+    myNumNodes++;
+    return node;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::destroyNode(Node* node)
+{
+    if (node->previous != nullptr) { node->previous->next = node->next; }
+    else { myFirst = node->next; }
+    if (node->next != nullptr) { node->next->previous = node->previous; }
+    else { myLast = node->previous; }
+    node->~Node();
+    myNodeAllocator.deallocate(node);
+    myNumNodes--;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::mergeWithNext(Node* node)
+{
+    auto next{node->next};
+    if (next == nullptr || node->count >= NodeCapacity / 2 ||
+        node->count + next->count > NodeCapacity)
+    {
+        return;
+    }
+    for (size_t i{}; i < next->count; ++i)
+    {
+        node->data[node->count++] = utils::move(next->data[i]);
+    }
+    destroyNode(next);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::shiftRight(Node* node, const size_t index)
+{
+    for (size_t i{node->count}; i > index; --i)
+    {
+        node->data[i] = utils::move(node->data[i - 1]);
+    }
+    node->count++;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::shiftLeft(Node* node, const size_t index)
+{
+    for (size_t i{index}; i + 1 < node->count; ++i)
+    {
+        node->data[i] = utils::move(node->data[i + 1]);
+    }
+    node->count--;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+UnrolledList<T, NodeCapacity, Allocation>::Iterator::Iterator() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+UnrolledList<T, NodeCapacity, Allocation>::Iterator::Iterator(Node* node, const size_t index)
+    : myNode{node}
+    , myIndex{index} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::Iterator::operator++()
+{
+    if (++myIndex >= myNode->count)
+    {
+        myNode = myNode->next;
+        myIndex = 0;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::Iterator::operator++(int) { ++(*this); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::Iterator::operator--()
+{
+    if (myIndex > 0)
+    {
+        myIndex--;
+        return;
+    }
+    myNode = myNode->previous;
+    myIndex = myNode != nullptr ? myNode->count - 1U : 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::Iterator::operator--(int) { --(*this); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::Iterator::operator+=(const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i) { ++(*this); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::Iterator::operator-=(const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i) { --(*this); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::Iterator::operator==(const Iterator& other) const
+{
+    return myNode == other.myNode && myIndex == other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::Iterator::operator!=(const Iterator& other) const
+{
+    return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+T& UnrolledList<T, NodeCapacity, Allocation>::Iterator::operator*()
+{
+    return myNode->data[myIndex];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::ConstIterator(const Node* node,
+                                                                        const size_t index)
+    : myNode{node}
+    , myIndex{index} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::operator++()
+{
+    if (++myIndex >= myNode->count)
+    {
+        myNode = myNode->next;
+        myIndex = 0;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::operator++(int) { ++(*this); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::operator--()
+{
+    if (myIndex > 0)
+    {
+        myIndex--;
+        return;
+    }
+    myNode = myNode->previous;
+    myIndex = myNode != nullptr ? myNode->count - 1U : 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::operator--(int) { --(*this); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::operator+=(
+    const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i) { ++(*this); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+void UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::operator-=(
+    const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i) { --(*this); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::operator==(
+    const ConstIterator& other) const
+{
+    return myNode == other.myNode && myIndex == other.myIndex;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+bool UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::operator!=(
+    const ConstIterator& other) const
+{
+    return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t NodeCapacity, typename Allocation>
+const T& UnrolledList<T, NodeCapacity, Allocation>::ConstIterator::operator*() const
+{
+    return myNode->data[myIndex];
+}
+
+} // namespace container
\ No newline at end of file
@@ -1,33 +1,64 @@
-/********************************************************************************
- * @brief Implementation details of miscellaneous utility functions.
- * 
- * @note Don't include this file directly.
- ********************************************************************************/
- #include "utils.h"
-
- // -----------------------------------------------------------------------------
- void delayS(const uint16_t& delayTimeS)
- {
-     for (uint16_t i{}; i < delayTimeS; ++i)
-     {
-         _delay_ms(1000);
-     }
- }
-
- // -----------------------------------------------------------------------------
- void delayMs(const uint16_t& delayTimeMs)
- {
-     for (uint16_t i{}; i < delayTimeMs; ++i)
-     {
-         _delay_ms(1);
-     }
- }
-
- // -----------------------------------------------------------------------------
- void delayUs(const uint16_t& delayTimeUs)
- {
-     for (uint16_t i{}; i < delayTimeUs; ++i)
-     {
-         _delay_us(1);
-     }
- }
\ No newline at end of file
+/********************************************************************************
+ * @brief Implementation details of miscellaneous utility functions.
+ *
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#include "utils.h"
+
+namespace utils
+{
+
+#ifdef __AVR__
+// -----------------------------------------------------------------------------
+__attribute__((naked)) void delayCycles(const uint32_t)
+{
+    // The delay is written in assembly, so that the number of cycles doesn't
+    // depend on the code generated by the compiler. The cycles are passed in
+    // r25:r22. The cycle counts in the comments are those of the ATmega328P
+    // according to the AVR instruction set manual. Including the CALL of four
+    // cycles, a delay of c >= 31 cycles takes 31 + 8 * floor((c - 31) / 8)
+    // cycles, while shorter delays take 14 cycles. The delay model in
+    // bench/delay_model.cpp simulates this sequence; keep both in sync.
+    asm volatile(
+        // Subtract the overhead of 31 cycles, return at once if the delay is
+        // shorter than that.
+        "subi r22, 31     \n\t" // 1
+        "sbci r23, 0      \n\t" // 1
+        "sbci r24, 0      \n\t" // 1
+        "sbci r25, 0      \n\t" // 1
+        "brcs 2f          \n\t" // 1, 2 if taken
+
+        // Divide the remaining cycles by eight cycles per iteration.
+        "lsr r25          \n\t" // 1
+        "ror r24          \n\t" // 1
+        "ror r23          \n\t" // 1
+        "ror r22          \n\t" // 1
+        "lsr r25          \n\t" // 1
+        "ror r24          \n\t" // 1
+        "ror r23          \n\t" // 1
+        "ror r22          \n\t" // 1
+        "lsr r25          \n\t" // 1
+        "ror r24          \n\t" // 1
+        "ror r23          \n\t" // 1
+        "ror r22          \n\t" // 1
+
+        // Count down to below zero, eight cycles per iteration and six for the
+        // last one.
+        "1:               \n\t"
+        "subi r22, 1      \n\t" // 1
+        "sbci r23, 0      \n\t" // 1
+        "sbci r24, 0      \n\t" // 1
+        "sbci r25, 0      \n\t" // 1
+        "brcs 2f          \n\t" // 1, 2 if taken
+        "nop              \n\t" // 1
+        "rjmp 1b          \n\t" // 2
+        "2:               \n\t"
+        "ret              \n\t" // 4
+    );
+}
+#else
+// -----------------------------------------------------------------------------
+void delayCycles(const uint32_t cycles) { (void)cycles; }
+#endif
+
+} // namespace utils
@@ -1,236 +1,478 @@
-/********************************************************************************
- * @brief Contains miscellaneous utility functions for bit operations, 
- *        mathematical operations and generating delays.
- ********************************************************************************/
-#pragma once
-
-#define F_CPU 16000000UL
-
-#include <stdint.h>
-#include <stdlib.h>
-#include <stdio.h>
-#include <avr/interrupt.h>
-#include <util/delay.h>
-#include "type_traits.h"
-
-namespace utils 
-{
-
-/********************************************************************************
- * @brief Blocks the calling thread for the specified time measured in seconds.
- *
- * @param delayTimeS The time to block the thread in seconds.
- ********************************************************************************/
-void delayS(const uint16_t& delayTimeS);
-
-/********************************************************************************
- * @brief Blocks the calling thread for the specified time measured in 
- *        milliseconds.
- *
- * @param delayTimeMs The time to block the thread in milliseconds.
- ********************************************************************************/
-void delayMs(const uint16_t& delayTimeMs);
-
-/********************************************************************************
- * @brief Blocks the calling thread for the specified time measured in 
- *        microseconds.
- *
- * @param delayTimeUs The time to block the thread in microseconds.
- ********************************************************************************/
-void delayUs(const uint16_t& delayTimeUs);
-
-namespace 
-{
-
-/********************************************************************************
- * @brief Structure used for removing references in order to maintain value
- *        categories between function calls.
- ********************************************************************************/
-template <typename T>
-struct RemoveReference
-{
-    typedef T type;
-};
-
-/********************************************************************************
- * @brief Maintains the value category of specified value.
- *
- * @param value The value whose value category is to maintain.
- *
- * @return Specified value with maintained value category.
- ********************************************************************************/
-template <typename T>
-constexpr T&& forward(typename RemoveReference<T>::type& value);
-
-/********************************************************************************
- * @brief Maintains the value category of specified value.
- *
- * @param value The value whose value category is to maintain.
- *
- * @return Specified value with maintained value category.
- ********************************************************************************/
-template <typename T>
-constexpr T&& forward(typename RemoveReference<T>::type&& value);
-
-/********************************************************************************
- * @brief Enables interrupts globally.
- ********************************************************************************/
-inline void globalInterruptEnable(void);
-
-/********************************************************************************
- * @brief Disables interrupts globally.
- ********************************************************************************/
-inline void globalInterruptDisable(void);
-
-/********************************************************************************
- * @brief Sets specified bit of selected register.
- *
- * @param reg
- *        The destination register.
- * @param bit
- *        The specified bit to set.
- ********************************************************************************/
-template <typename T = uint8_t>
-constexpr void set(volatile T& reg, const uint8_t bit);
-
-/********************************************************************************
- * @brief Sets specified bits of selected register.
- *
- * @param reg  The destination register.
- * @param bit  The first bit to set.
- * @param bits The others bits to set.
- ********************************************************************************/
-template <typename T = uint8_t, typename... Bits>
-constexpr void set(volatile T& reg, const uint8_t bit, const Bits&&... bits);
-
-/********************************************************************************
- * @brief Clears specified bit of selected register.
- *
- * @param reg The destination register.
- * @param bit The specified bit to clear.
- ********************************************************************************/
-template <typename T = uint8_t>
-constexpr void clear(volatile T& reg, const uint8_t bit);
-
-/********************************************************************************
- * @brief Clears specified bits of selected register.
- *
- * @param reg  The destination register.
- * @param bit  The first bit to clear.
- * @param bits The others bits to clear.
- ********************************************************************************/
-template <typename T = uint8_t, typename... Bits>
-constexpr void clear(volatile T& reg, const uint8_t bit, const Bits&&... bits);
-
-/********************************************************************************
- * @brief Toggles specified bit of selected register.
- *
- * @param reg The destination register.
- * @param bit The specified bit to toggle.
- ********************************************************************************/
-template <typename T = uint8_t>
-constexpr void toggle(volatile T& reg, const uint8_t bit);
-
-/********************************************************************************
- * @brief Toggles specified bits of selected register.
- *
- * @param reg  The destination register.
- * @param bit  The first bit to toggle.
- * @param bits The others bits to toggle.
- ********************************************************************************/
-template <typename T = uint8_t, typename... Bits>
-constexpr void toggle(volatile T& reg, const uint8_t bit, const Bits&&... bits);
-
-/********************************************************************************
- * @brief Reads specified bit of selected register.
- *
- * @param reg The destination register.
- * @param bit The specified bit to read.
- *
- * @return True if the specified bit is high, else false.
- ********************************************************************************/
-template <typename T = uint8_t>
-constexpr bool read(const volatile T& reg, const uint8_t bit);
-
-/********************************************************************************
- * @brief Reads specified bits of selected register.
- *
- * @param reg  The destination register.
- * @param bit  The first bit to read.
- * @param bits The other bits to read.
- *
- * @return True if at least one of the specified bits is high, else false.
- ********************************************************************************/
-template <typename T = uint8_t, typename... Bits>
-constexpr bool read(const volatile T& reg, const uint8_t bit, const Bits&&... bits);
-
-/********************************************************************************
- * @brief Calculates the power of specified base and exponent, where
- *
- *                           power = base ^ exponent
- *
- * @param base     Specified base.
- * @param exponent Specified exponent.
- *
- * @return The corresponding power.
- ********************************************************************************/
-template <typename T1 = double, typename T2 = double, typename T3 = double>
-T3 power(const T1 base, const T2 exponent);
-
-/********************************************************************************
- * @brief Rounds the specified number to the nearest integer.
- *
- * @param number The number to round.
- *
- * @return The corresponding rounded number.
- ********************************************************************************/
-template <typename T1 = int32_t, typename T2 = double>
-constexpr T1 round(const T2 value);
-
-/********************************************************************************
- * @brief Allocates a new block of on the heap.
- *
- * @param size The size of the allocated block in number of elements it can hold
- *             (default = one element).
- *
- * @return A pointer to the allocated block at success, else a null pointer.
- ********************************************************************************/
-template <typename T>
-inline T* newMemory(const size_t size = 1);
-
-/********************************************************************************
- * @brief Resizes referenced heap allocated block via reallocation.
- *
- * @param block    The block to resize.
- * @param new_size The new size of the allocated block, i.e. the number of
- *                 elements it can hold after reallocation.
- *
- * @return A pointer to the resized block at success, else a null pointer.
- ********************************************************************************/
-template <typename T>
-inline T* reallocMemory(T* block, const size_t new_size);
-
-/********************************************************************************
- * @brief Deletes heap allocated block via deallocation. The pointer to the
- *        block is set to null after deallocation.
- *
- * @param block Reference to the block to delete.
- ********************************************************************************/
-template <typename T>
-inline void deleteMemory(T* &block);
-
-/********************************************************************************
- * @brief Moves memory from specified source to a copy. The copy will gain
- *        ownership of the memory and the source will be emptied.
- *
- * @param source Reference to the source whose memory is moved.
- *
- * @return The copy of the source.
- ********************************************************************************/
-template <typename T>
-inline T move(T&& source);
-
-} // namespace
-} // namespace utils
-
+/********************************************************************************
+ * @brief Contains miscellaneous utility functions for bit operations, 
+ *        mathematical operations and generating delays.
+ ********************************************************************************/
+#pragma once
+
+#define F_CPU 16000000UL
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "fixed.h"
+#include "type_traits.h"
+
+#ifdef UTILS_MEMORY_STATS
+#include "memory_stats.h"
+#endif
+
+#ifdef __AVR__
+#include <avr/interrupt.h>
+#include <util/delay.h>
+
+/********************************************************************************
+ * @brief Constructs an object at specified address (placement new). Declared 
+ *        here since <new> isn't provided by avr-libc.
+ *
+ * @param address The address at which the object is constructed.
+ *
+ * @return The specified address.
+ ********************************************************************************/
+inline void* operator new(size_t, void* address) noexcept { return address; }
+#else
+/********************************************************************************
+ * @note The containers and utility templates can also be compiled by a host
+ *       compiler, for instance to measure their performance on a PC. The AVR
+ *       headers are excluded and interrupt control becomes a no-op in that case.
+ ********************************************************************************/
+#include <new>
+#endif
+
+namespace utils 
+{
+
+/********************************************************************************
+ * @brief Blocks the calling thread for specified number of CPU cycles. The
+ *        31 cycles spent on the call and the setup are subtracted from the
+ *        delay, which is then rounded down to whole loop iterations of eight
+ *        cycles, so the delay is up to seven cycles short. Delays shorter than
+ *        31 cycles take 14 cycles.
+ *
+ * @param cycles The number of CPU cycles to block the thread.
+ *
+ * @note The cycles are counted from the CALL of this function to the return.
+ *       The cycles the caller spends computing the argument aren't included.
+ *       When the linker relaxes the CALL into an RCALL, the delay is one cycle
+ *       shorter. Prefer delayS, delayMs and delayUs below, which are exact to
+ *       the cycle when the delay time is a compile-time constant.
+ ********************************************************************************/
+void delayCycles(const uint32_t cycles);
+
+/********************************************************************************
+ * @brief Structure holding a location in the source code, used to record the
+ *        call sites of heap allocations in the memory statistics.
+ *
+ * @param file The name of the file without its directory.
+ * @param line The line number.
+ ********************************************************************************/
+struct SourceLocation
+{
+    const char* file;
+    uint16_t line;
+
+    /********************************************************************************
+     * @brief Provides the location of the call. When used as default argument,
+     *        the location of the caller of the function is provided instead.
+     *
+     * @param file The path of the file (default = the file of the call).
+     * @param line The line number (default = the line of the call).
+     *
+     * @return The location, where the directory is stripped from the path.
+     ********************************************************************************/
+    static constexpr SourceLocation current(const char* file = __builtin_FILE(),
+                                            const uint16_t line = __builtin_LINE());
+};
+
+namespace 
+{
+
+/********************************************************************************
+ * @brief Structure used for removing references in order to maintain value
+ *        categories between function calls.
+ ********************************************************************************/
+template <typename T>
+struct RemoveReference
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Removes lvalue reference from specified type.
+ ********************************************************************************/
+template <typename T>
+struct RemoveReference<T&>
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Removes rvalue reference from specified type.
+ ********************************************************************************/
+template <typename T>
+struct RemoveReference<T&&>
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Maintains the value category of specified value.
+ *
+ * @param value The value whose value category is to maintain.
+ *
+ * @return Specified value with maintained value category.
+ ********************************************************************************/
+template <typename T>
+constexpr T&& forward(typename RemoveReference<T>::type& value);
+
+/********************************************************************************
+ * @brief Maintains the value category of specified value.
+ *
+ * @param value The value whose value category is to maintain.
+ *
+ * @return Specified value with maintained value category.
+ ********************************************************************************/
+template <typename T>
+constexpr T&& forward(typename RemoveReference<T>::type&& value);
+
+/********************************************************************************
+ * @brief Blocks the calling thread for the specified time measured in seconds.
+ *
+ * @param delayTimeS The time to block the thread in seconds.
+ ********************************************************************************/
+inline void delayS(const uint16_t delayTimeS);
+
+/********************************************************************************
+ * @brief Blocks the calling thread for the specified time measured in 
+ *        milliseconds.
+ *
+ * @param delayTimeMs The time to block the thread in milliseconds.
+ ********************************************************************************/
+inline void delayMs(const uint16_t delayTimeMs);
+
+/********************************************************************************
+ * @brief Blocks the calling thread for the specified time measured in 
+ *        microseconds.
+ *
+ * @param delayTimeUs The time to block the thread in microseconds.
+ *
+ * @note Delays shorter than the 31-cycle overhead of delayCycles, i.e.
+ *       less than two microseconds at 16 MHz, take 14 cycles unless the delay
+ *       time is a compile-time constant.
+ ********************************************************************************/
+inline void delayUs(const uint16_t delayTimeUs);
+
+/********************************************************************************
+ * @brief Enables interrupts globally.
+ ********************************************************************************/
+inline void globalInterruptEnable(void);
+
+/********************************************************************************
+ * @brief Disables interrupts globally.
+ ********************************************************************************/
+inline void globalInterruptDisable(void);
+
+/********************************************************************************
+ * @brief Creates a bit mask where specified bits are high, for instance
+ *
+ *            mask(ADEN, ADSC) == (1 << ADEN) | (1 << ADSC)
+ *
+ *        The mask is computed at compile time if the bits are constants.
+ *
+ * @tparam T The type of the mask, must be an unsigned integral type.
+ *
+ * @param bit  The first bit to set in the mask.
+ * @param bits The other bits to set in the mask.
+ *
+ * @return The corresponding bit mask.
+ ********************************************************************************/
+template <typename T = uint8_t, typename... Bits>
+constexpr T mask(const uint8_t bit, const Bits... bits);
+
+/********************************************************************************
+ * @brief Sets specified bits of selected register. The bits are combined into 
+ *        one mask, so the register is read and written once regardless of the
+ *        number of bits. Setting a single constant bit of a register in the 
+ *        I/O space is compiled into one SBI instruction.
+ *
+ * @param reg  The destination register.
+ * @param bit  The first bit to set.
+ * @param bits The other bits to set.
+ ********************************************************************************/
+template <typename T = uint8_t, typename... Bits>
+constexpr void set(volatile T& reg, const uint8_t bit, const Bits... bits);
+
+/********************************************************************************
+ * @brief Clears specified bits of selected register. The bits are combined into
+ *        one mask, so the register is read and written once regardless of the
+ *        number of bits. Clearing a single constant bit of a register in the 
+ *        I/O space is compiled into one CBI instruction.
+ *
+ * @param reg  The destination register.
+ * @param bit  The first bit to clear.
+ * @param bits The other bits to clear.
+ ********************************************************************************/
+template <typename T = uint8_t, typename... Bits>
+constexpr void clear(volatile T& reg, const uint8_t bit, const Bits... bits);
+
+/********************************************************************************
+ * @brief Toggles specified bits of selected register. The bits are combined 
+ *        into one mask, so the register is read and written once regardless of
+ *        the number of bits.
+ *
+ * @param reg  The destination register.
+ * @param bit  The first bit to toggle.
+ * @param bits The other bits to toggle.
+ ********************************************************************************/
+template <typename T = uint8_t, typename... Bits>
+constexpr void toggle(volatile T& reg, const uint8_t bit, const Bits... bits);
+
+/********************************************************************************
+ * @brief Writes specified value to the bits of selected register that are high
+ *        in specified mask, while the other bits are left unchanged. The 
+ *        register is read and written once, for instance
+ *
+ *            write(ADMUX, mask(MUX0, MUX1, MUX2, MUX3), channel);
+ *
+ *        selects the ADC channel without affecting the reference bits.
+ *
+ * @param reg   The destination register.
+ * @param mask  Mask holding the bits to write.
+ * @param value The value to write, bits outside the mask are ignored.
+ ********************************************************************************/
+template <typename T = uint8_t>
+constexpr void write(volatile T& reg, const typename type_traits::type_identity<T>::type mask,
+                     const typename type_traits::type_identity<T>::type value);
+
+/********************************************************************************
+ * @brief Reads specified bits of selected register. The register is read once
+ *        regardless of the number of bits.
+ *
+ * @param reg  The destination register.
+ * @param bit  The first bit to read.
+ * @param bits The other bits to read.
+ *
+ * @return True if at least one of the specified bits is high, else false.
+ ********************************************************************************/
+template <typename T = uint8_t, typename... Bits>
+constexpr bool read(const volatile T& reg, const uint8_t bit, const Bits... bits);
+
+/********************************************************************************
+ * @brief Calculates the power of specified base and exponent, where
+ *
+ *                           power = base ^ exponent
+ *
+ *        The power is calculated by squaring, i.e. with at most two
+ *        multiplications per bit of the exponent.
+ *
+ * @tparam T1 The type of the base, must be an arithmetic type.
+ * @tparam T2 The type of the exponent, must be an unsigned integral type.
+ * @tparam T3 The type of the power (default = the type of the base).
+ *
+ * @param base     Specified base.
+ * @param exponent Specified exponent.
+ *
+ * @return The corresponding power. Overflow of integral powers isn't
+ *         detected, use the overload below in that case.
+ ********************************************************************************/
+template <typename T1 = int32_t, typename T2 = uint8_t, typename T3 = T1>
+constexpr T3 power(const T1 base, const T2 exponent);
+
+/********************************************************************************
+ * @brief Calculates the power of specified integral base and exponent by
+ *        squaring and detects overflow.
+ *
+ * @tparam T The type of the base and the power, must be an integral type.
+ *
+ * @param base     Specified base.
+ * @param exponent Specified exponent.
+ * @param result   Reference to variable storing the power.
+ *
+ * @return True if the power fits in T, else false, in which case the result
+ *         is left unchanged.
+ ********************************************************************************/
+template <typename T>
+constexpr bool power(const T base, const uint8_t exponent, T& result);
+
+/********************************************************************************
+ * @brief Calculates the integer square root of specified value, i.e. the
+ *        largest integer whose square doesn't exceed the value. Only shifts,
+ *        additions and subtractions are used.
+ *
+ * @tparam T The type of the value, must be an unsigned integral type.
+ *
+ * @param value The value whose square root is calculated.
+ *
+ * @return The square root of the value rounded down.
+ ********************************************************************************/
+template <typename T>
+constexpr T isqrt(T value);
+
+/********************************************************************************
+ * @brief Calculates the base-2 logarithm of specified value rounded down, i.e.
+ *        the index of the most significant high bit.
+ *
+ * @tparam T The type of the value, must be an unsigned integral type.
+ *
+ * @param value The value whose logarithm is calculated.
+ *
+ * @return The base-2 logarithm of the value rounded down or 0 if the value
+ *         is 0.
+ ********************************************************************************/
+template <typename T>
+constexpr uint8_t ilog2(T value);
+
+/********************************************************************************
+ * @brief Calculates the product of specified multiplicands divided by specified
+ *        divisor, where
+ *
+ *                           quotient = a * b / divisor
+ *
+ *        The product is held in 64 bits, so it can't overflow.
+ *
+ * @param a       The first multiplicand.
+ * @param b       The second multiplicand.
+ * @param divisor The divisor.
+ *
+ * @return The quotient rounded down or UINT64_MAX if the divisor is 0.
+ ********************************************************************************/
+constexpr uint64_t muldiv(const uint32_t a, const uint32_t b, const uint32_t divisor);
+
+/********************************************************************************
+ * @brief Rounds the specified number to the nearest integer, where halves are
+ *        rounded away from zero.
+ *
+ * @param number The number to round.
+ *
+ * @return The corresponding rounded number.
+ *
+ * @note Floating-point numbers are rounded in their own precision. Prefer
+ *       fixed-point numbers at runtime, since floating-point arithmetic is
+ *       performed by slow soft-float routines on the ATmega328P.
+ ********************************************************************************/
+template <typename T1 = int32_t, typename T2>
+constexpr T1 round(const T2 value);
+
+/********************************************************************************
+ * @brief Rounds the specified fixed-point number to the nearest integer, where
+ *        halves are rounded away from zero. Only integer operations are used.
+ *
+ * @tparam IntBits  The number of integer bits of the fixed-point number.
+ * @tparam FracBits The number of fractional bits of the fixed-point number.
+ *
+ * @param value The number to round.
+ *
+ * @return The corresponding rounded number, saturated to the range of T1.
+ ********************************************************************************/
+template <typename T1 = int32_t, uint8_t IntBits, uint8_t FracBits>
+constexpr T1 round(const Fixed<IntBits, FracBits>& value);
+
+/********************************************************************************
+ * @brief Allocates a new block of on the heap.
+ *
+ * @param size     The size of the allocated block in number of elements it can
+ *                 hold (default = one element).
+ * @param location The call site recorded in the memory statistics when
+ *                 UTILS_MEMORY_STATS is defined, see memory_stats.h
+ *                 (default = the location of the caller).
+ *
+ * @return A pointer to the allocated block at success, else a null pointer.
+ ********************************************************************************/
+template <typename T>
+inline T* newMemory(const size_t size = 1,
+                    const SourceLocation& location = SourceLocation::current());
+
+/********************************************************************************
+ * @brief Resizes referenced heap allocated block via reallocation.
+ *
+ * @param block    The block to resize.
+ * @param new_size The new size of the allocated block, i.e. the number of
+ *                 elements it can hold after reallocation.
+ * @param location The call site recorded in the memory statistics when
+ *                 UTILS_MEMORY_STATS is defined, see memory_stats.h
+ *                 (default = the location of the caller).
+ *
+ * @return A pointer to the resized block at success, else a null pointer.
+ ********************************************************************************/
+template <typename T>
+inline T* reallocMemory(T* block, const size_t new_size,
+                        const SourceLocation& location = SourceLocation::current());
+
+/********************************************************************************
+ * @brief Deletes heap allocated block via deallocation. The pointer to the
+ *        block is set to null after deallocation.
+ *
+ * @param block Reference to the block to delete.
+ ********************************************************************************/
+template <typename T>
+inline void deleteMemory(T* &block);
+
+/********************************************************************************
+ * @brief Casts specified source to an rvalue reference so that its memory can
+ *        be moved instead of copied. The object the source is moved to gains 
+ *        ownership of the memory and the source is emptied.
+ *
+ * @param source Reference to the source whose memory is to be moved.
+ *
+ * @return An rvalue reference to the source.
+ ********************************************************************************/
+template <typename T>
+constexpr typename RemoveReference<T>::type&& move(T&& source);
+
+/********************************************************************************
+ * @brief Constructs an object at specified address with specified arguments.
+ *
+ * @tparam Args Parameter pack containing the constructor arguments.
+ *
+ * @param address The address at which the object is constructed.
+ * @param args    The arguments passed to the constructor of the object.
+ *
+ * @return A pointer to the constructed object.
+ ********************************************************************************/
+template <typename T, typename... Args>
+inline T* construct(T* address, Args&&... args);
+
+/********************************************************************************
+ * @brief Swaps the content of referenced objects via move semantics.
+ *
+ * @param a Reference to the first object.
+ * @param b Reference to the second object.
+ ********************************************************************************/
+template <typename T>
+constexpr void swap(T& a, T& b);
+
+/********************************************************************************
+ * @brief Copies specified number of trivially copyable elements. The elements
+ *        are copied as one block via memmove, except at compile time, where
+ *        they're copied one by one.
+ *
+ * @param destination Pointer to the first destination element.
+ * @param source      Pointer to the first source element.
+ * @param count       The number of elements to copy.
+ *
+ * @note The destination may only overlap the source if it starts before the
+ *       source, for instance when closing a gap after a removed element.
+ ********************************************************************************/
+template <typename T>
+constexpr typename type_traits::enable_if<type_traits::is_trivially_copyable<T>::value>::type
+    copyElements(T* destination, const T* source, const size_t count);
+
+/********************************************************************************
+ * @brief Copies specified number of elements that aren't trivially copyable.
+ *        The elements are copied one by one via their assignment operator.
+ *
+ * @param destination Pointer to the first destination element.
+ * @param source      Pointer to the first source element.
+ * @param count       The number of elements to copy.
+ *
+ * @note The destination may only overlap the source if it starts before the
+ *       source, for instance when closing a gap after a removed element.
+ ********************************************************************************/
+template <typename T>
+constexpr typename type_traits::enable_if<!type_traits::is_trivially_copyable<T>::value>::type
+    copyElements(T* destination, const T* source, const size_t count);
+
+} // namespace
+} // namespace utils
+
 #include "utils_impl.h"
\ No newline at end of file
@@ -1,164 +1,363 @@
-/********************************************************************************
- * @brief Implementation details of miscellaneous utility function templates.
- * 
- * @note Don't include this file directly.
- ********************************************************************************/
-#pragma once
-
-namespace utils
-{
-namespace
-{
-
-// -----------------------------------------------------------------------------
-template <typename T>
-constexpr T&& forward(typename RemoveReference<T>::type& value)
-{
-    return static_cast<T&&>(value);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-constexpr T&& forward(typename RemoveReference<T>::type&& value)
-{
-    return static_cast<T&&>(value);
-}
-
-// -----------------------------------------------------------------------------
-inline void globalInterruptEnable(void) { asm("SEI"); }
-
-// -----------------------------------------------------------------------------
-inline void globalInterruptDisable(void) { asm("CLI"); }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-constexpr void set(volatile T& reg, const uint8_t bit)  
-{
-    static_assert(type_traits::is_unsigned<T>::value, 
-        "Invalid data type used for bit manipulation!");
-	reg |= (1ULL << bit);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T, typename... Bits>
-constexpr void set(volatile T& reg, const uint8_t bit, const Bits&&... bits)  
-{
-    static_assert(type_traits::is_unsigned<T>::value, 
-        "Invalid data type used for bit manipulation!");
-    set(reg, bit);
-	set(reg, forward<const Bits>(bits)...);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-constexpr void clear(volatile T& reg, const uint8_t bit)  
-{
-    static_assert(type_traits::is_unsigned<T>::value, 
-        "Invalid data type used for bit manipulation!");
-    reg &= ~(1ULL << bit);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T, typename... Bits>
-constexpr void clear(volatile T& reg, const uint8_t bit, const Bits&&... bits)  
-{
-    static_assert(type_traits::is_unsigned<T>::value, 
-        "Invalid data type used for bit manipulation!");
-    clear(reg, bit);
-	clear(reg, forward<const Bits>(bits)...);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-constexpr void toggle(volatile T& reg, const uint8_t bit)  
-{
-    static_assert(type_traits::is_unsigned<T>::value, 
-        "Invalid data type used for bit manipulation!");
-    reg ^= (1ULL << bit);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T, typename... Bits>
-constexpr void toggle(volatile T& reg, const uint8_t bit, const Bits&&... bits)  
-{
-    toggle(reg, bit);
-	toggle(reg, forward<const Bits>(bits)...);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-constexpr bool read(const volatile T& reg, const uint8_t bit)  
-{
-    static_assert(type_traits::is_unsigned<T>::value, 
-        "Invalid data type used for bit manipulation!");
-    return reg & (1ULL << bit);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T, typename... Bits>
-constexpr bool read(const volatile T& reg, const uint8_t bit, const Bits&&... bits) 
-{
-    static_assert(type_traits::is_unsigned<T>::value, 
-        "Invalid data type used for bit manipulation!");
-    return read(reg, bit) | read(reg, forward<const Bits>(bits)...);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T1, typename T2, typename T3>
-T3 power(const T1 base, const T2 exponent) 
-{
-	static_assert(type_traits::is_arithmetic<T1>::value &&
-	              type_traits::is_arithmetic<T2>::value &&
-	              type_traits::is_arithmetic<T3>::value,
-	              "Calculation of power only possible for arithmetic types!");
-	T1 num{1};
-	for (uint16_t i{}; i < exponent; ++i) 
-    {
-	    num *= base;
-    }
-    return static_cast<T3>(num);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T1, typename T2>
-constexpr T1 round(const T2 value) 
-{
-    static_assert(type_traits::is_integral<T1>::value && 
-                  type_traits::is_arithmetic<T2>::value, 
-	              "Rounding only possible for arithmetic types!");
-    return static_cast<T1>(value + 0.5);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-inline T* newMemory(const size_t size) 
-{
-    return static_cast<T*>(malloc(sizeof(T) * size));
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-inline T* reallocMemory(T* block, const size_t new_size) 
-{
-    return static_cast<T*>(realloc(block, sizeof(T) * new_size));
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-inline void deleteMemory(T* &block) 
-{
-    free(block);
-    block = nullptr;
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-inline T move(T&& source) 
-{
-    T copy{source};
-    source = {};
-    return copy;
-}
-
-} // namespace
+/********************************************************************************
+ * @brief Implementation details of miscellaneous utility function templates.
+ * 
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once
+
+namespace utils
+{
+
+// -----------------------------------------------------------------------------
+constexpr SourceLocation SourceLocation::current(const char* file, const uint16_t line)
+{
+    // The path depends on how the project is built, so only the name is kept.
+    const char* name{file};
+    for (auto c{file}; *c != '\0'; ++c)
+    {
+        if (*c == '/' || *c == '\\') { name = c + 1; }
+    }
+    return SourceLocation{name, line};
+}
+
+namespace
+{
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T&& forward(typename RemoveReference<T>::type& value)
+{
+    return static_cast<T&&>(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T&& forward(typename RemoveReference<T>::type&& value)
+{
+    return static_cast<T&&>(value);
+}
+
+// -----------------------------------------------------------------------------
+#ifdef __AVR__
+inline void globalInterruptEnable(void) { asm("SEI"); }
+
+// -----------------------------------------------------------------------------
+inline void globalInterruptDisable(void) { asm("CLI"); }
+#else
+inline void globalInterruptEnable(void) {}
+
+// -----------------------------------------------------------------------------
+inline void globalInterruptDisable(void) {}
+#endif
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Bits>
+constexpr T mask(const uint8_t bit, const Bits... bits)
+{
+    static_assert(type_traits::is_unsigned<T>::value, 
+        "Invalid data type used for bit manipulation!");
+    return static_cast<T>(((static_cast<T>(1U) << bit) | ... | 
+                           (static_cast<T>(1U) << static_cast<uint8_t>(bits))));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Bits>
+constexpr void set(volatile T& reg, const uint8_t bit, const Bits... bits)  
+{
+	reg |= mask<T>(bit, bits...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Bits>
+constexpr void clear(volatile T& reg, const uint8_t bit, const Bits... bits)  
+{
+    reg &= static_cast<T>(~mask<T>(bit, bits...));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Bits>
+constexpr void toggle(volatile T& reg, const uint8_t bit, const Bits... bits)  
+{
+    reg ^= mask<T>(bit, bits...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr void write(volatile T& reg, const typename type_traits::type_identity<T>::type mask,
+                     const typename type_traits::type_identity<T>::type value)
+{
+    static_assert(type_traits::is_unsigned<T>::value, 
+        "Invalid data type used for bit manipulation!");
+    reg = static_cast<T>((reg & static_cast<T>(~mask)) | (value & mask));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Bits>
+constexpr bool read(const volatile T& reg, const uint8_t bit, const Bits... bits)  
+{
+    return (reg & mask<T>(bit, bits...)) != 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T1, typename T2, typename T3>
+constexpr T3 power(const T1 base, const T2 exponent) 
+{
+	static_assert(type_traits::is_arithmetic<T1>::value &&
+	              type_traits::is_unsigned<T2>::value &&
+	              type_traits::is_arithmetic<T3>::value,
+	              "Calculation of power only possible for arithmetic types and unsigned exponents!");
+	T3 result{1};
+    T3 factor{static_cast<T3>(base)};
+	for (T2 bits{exponent}; bits; bits >>= 1U) 
+    {
+	    if (bits & 1U) { result *= factor; }
+        if (bits > 1U) { factor *= factor; }
+    }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr bool power(const T base, const uint8_t exponent, T& result)
+{
+    static_assert(type_traits::is_integral<T>::value, 
+        "Overflow detection of power only possible for integral types!");
+    T power{1};
+    T factor{base};
+    for (uint8_t bits{exponent}; bits; bits >>= 1U)
+    {
+        if ((bits & 1U) && __builtin_mul_overflow(power, factor, &power)) { return false; }
+        if (bits > 1U && __builtin_mul_overflow(factor, factor, &factor)) { return false; }
+    }
+    result = power;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T isqrt(T value)
+{
+    static_assert(type_traits::is_unsigned<T>::value, 
+        "Square root only possible for unsigned integral types!");
+    T root{};
+
+    // Determine one bit of the root per iteration, starting with the highest 
+    // power of four not exceeding the value.
+    T bit{static_cast<T>(static_cast<T>(1U) << (8U * sizeof(T) - 2U))};
+    while (bit > value) { bit >>= 2U; }
+
+    while (bit != 0U)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1U) + bit;
+        }
+        else { root >>= 1U; }
+        bit >>= 2U;
+    }
+    return root;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr uint8_t ilog2(T value)
+{
+    static_assert(type_traits::is_unsigned<T>::value, 
+        "Logarithm only possible for unsigned integral types!");
+    uint8_t result{};
+
+    // Binary search for the most significant high bit, one step per halving.
+    for (uint8_t shift{4U * sizeof(T)}; shift; shift >>= 1U)
+    {
+        if (value >> shift) 
+        { 
+            value >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint64_t muldiv(const uint32_t a, const uint32_t b, const uint32_t divisor)
+{
+    if (divisor == 0U) { return UINT64_MAX; }
+    const uint64_t product{static_cast<uint64_t>(a) * b};
+
+    // Use 32-bit division if the product fits, which is far cheaper on 8-bit targets.
+    if ((product >> 32U) == 0U) { return static_cast<uint32_t>(product) / divisor; }
+    return product / divisor;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T1, typename T2>
+constexpr T1 round(const T2 value) 
+{
+    static_assert(type_traits::is_integral<T1>::value && 
+                  type_traits::is_arithmetic<T2>::value, 
+	              "Rounding only possible for arithmetic types!");
+    if constexpr (type_traits::is_integral<T2>::value) { return static_cast<T1>(value); }
+    else
+    {
+        const T2 half{static_cast<T2>(0.5)};
+        return static_cast<T1>(value >= 0 ? value + half : value - half);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T1, uint8_t IntBits, uint8_t FracBits>
+constexpr T1 round(const Fixed<IntBits, FracBits>& value)
+{
+    return value.template round<T1>();
+}
+
+// -----------------------------------------------------------------------------
+#ifdef UTILS_MEMORY_STATS
+template <typename T>
+inline T* newMemory(const size_t size, const SourceLocation& location) 
+{
+    return static_cast<T*>(
+        memory_stats::detail::allocate(sizeof(T) * size, location.file, location.line));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline T* reallocMemory(T* block, const size_t new_size, const SourceLocation& location) 
+{
+    return static_cast<T*>(memory_stats::detail::reallocate(
+        block, sizeof(T) * new_size, location.file, location.line));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void deleteMemory(T* &block) 
+{
+    memory_stats::detail::deallocate(block);
+    block = nullptr;
+}
+#else
+template <typename T>
+inline T* newMemory(const size_t size, const SourceLocation&) 
+{
+    return static_cast<T*>(malloc(sizeof(T) * size));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline T* reallocMemory(T* block, const size_t new_size, const SourceLocation&) 
+{
+    return static_cast<T*>(realloc(block, sizeof(T) * new_size));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void deleteMemory(T* &block) 
+{
+    free(block);
+    block = nullptr;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr typename RemoveReference<T>::type&& move(T&& source) 
+{
+    return static_cast<typename RemoveReference<T>::type&&>(source);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Args>
+inline T* construct(T* address, Args&&... args)
+{
+    return new (address) T(forward<Args>(args)...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr void swap(T& a, T& b)
+{
+    T temp{move(a)};
+    a = move(b);
+    b = move(temp);
+}
+
+namespace detail
+{
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr void copyEach(T* destination, const T* source, const size_t count)
+{
+    for (size_t i{}; i < count; ++i) { destination[i] = source[i]; }
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr typename type_traits::enable_if<!type_traits::is_trivially_copyable<T>::value>::type
+    copyElements(T* destination, const T* source, const size_t count)
+{
+    detail::copyEach(destination, source, count);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr typename type_traits::enable_if<type_traits::is_trivially_copyable<T>::value>::type
+    copyElements(T* destination, const T* source, const size_t count)
+{
+    if (count == 0) { return; }
+    if (type_traits::is_constant_evaluated()) { detail::copyEach(destination, source, count); }
+    else { memmove(destination, source, count * sizeof(T)); }
+}
+
+namespace detail
+{
+
+constexpr uint32_t CyclesPerUs{F_CPU / 1000000UL};
+constexpr uint32_t CyclesPerMs{F_CPU / 1000UL};
+
+// -----------------------------------------------------------------------------
+__attribute__((always_inline)) inline void delay(const uint32_t cycles)
+{
+    // Constant delays are generated exactly by the compiler, while other delays
+    // are passed to the assembly loop in delayCycles.
+#if defined(__AVR__) && defined(__OPTIMIZE__)
+    if (__builtin_constant_p(cycles)) 
+    { 
+        __builtin_avr_delay_cycles(cycles); 
+        return;
+    }
+#endif
+    delayCycles(cycles);
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+__attribute__((always_inline)) inline void delayS(const uint16_t delayTimeS)
+{
+    // Delays whose number of cycles exceeds 32 bits are split into seconds.
+    if (__builtin_constant_p(delayTimeS) && delayTimeS <= UINT32_MAX / F_CPU)
+    {
+        detail::delay(delayTimeS * F_CPU);
+        return;
+    }
+    for (uint16_t i{}; i < delayTimeS; ++i) { detail::delay(F_CPU); }
+}
+
+// -----------------------------------------------------------------------------
+__attribute__((always_inline)) inline void delayMs(const uint16_t delayTimeMs)
+{
+    detail::delay(delayTimeMs * detail::CyclesPerMs);
+}
+
+// -----------------------------------------------------------------------------
+__attribute__((always_inline)) inline void delayUs(const uint16_t delayTimeUs)
+{
+    detail::delay(delayTimeUs * detail::CyclesPerUs);
+}
+
+} // namespace
 } // namespace utils
\ No newline at end of file
@@ -1,445 +1,512 @@
-/********************************************************************************
- * @brief Implementation details for the container::Vector class.
- * 
- * @note Don't include this file directly.
- ********************************************************************************/
-#pragma once 
-
-#include "utils.h"
-
-namespace container
-{
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Vector() = default;
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Vector(const size_t size) { resize(size); }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-template <typename... Values>
-Vector<T>::Vector(const Values&&... values) 
-{
-    const T array[sizeof...(values)]{(values)...};
-    addValues(array);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Vector(const Vector<T>& source) { copy(source); }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Vector(Vector&& source) 
-{
-    myData = source.myData;
-    mySize = source.mySize;
-    source.myData = nullptr;
-    source.mySize = 0;
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::~Vector() { clear(); }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-T& Vector<T>::operator[](const size_t index) { return myData[index]; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-const T& Vector<T>::operator[](const size_t index) const { return myData[index]; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-template <typename... Values>
-void Vector<T>::operator=(const Values&&... values) 
-{
-    clear();
-    copy(values...);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::operator=(const Vector<T>& source) 
-{
-    clear();
-    copy(source);
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-template <size_t NumValues>
-void Vector<T>::operator+=(const T (&values)[NumValues]) { addValues(values); }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::operator+=(const Vector<T>& source) { addValues(source); }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-const T* Vector<T>::data() const { return myData; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-size_t Vector<T>::size() const { return mySize; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::empty() const { return mySize == 0; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::Iterator Vector<T>::begin() { return Iterator{myData}; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::ConstIterator Vector<T>::begin() const 
-{ 
-    return ConstIterator{myData};
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::Iterator Vector<T>::end() 
-{ 
-    return Iterator{myData + mySize}; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::ConstIterator Vector<T>::end() const 
-{ 
-    return ConstIterator{myData + mySize};
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::Iterator Vector<T>::rbegin() 
-{ 
-    return mySize > 0 ? Iterator{myData + mySize - 1} : Iterator{nullptr}; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::ConstIterator Vector<T>::rbegin() const 
-{ 
-    return mySize > 0 ? ConstIterator{myData + mySize - 1} : ConstIterator{nullptr}; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::Iterator Vector<T>::rend() 
-{ 
-    return mySize > 0 ? Iterator{myData - 1} : Iterator{nullptr};
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::ConstIterator Vector<T>::rend() const 
-{ 
-    return mySize > 0 ? ConstIterator{myData - 1} : ConstIterator{nullptr};
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-T* Vector<T>::last() { return mySize > 0 ? end() - 1 : nullptr; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-const T* Vector<T>::last() const { return mySize > 0 ? end() - 1 : nullptr; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::clear() 
-{
-    utils::deleteMemory<T>(myData);
-    myData = nullptr;
-    mySize = 0;
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::resize(const size_t newSize) 
-{
-    auto copy{utils::reallocMemory<T>(myData, newSize)};
-    if (copy == nullptr) { return false; }
-    myData = copy;
-    mySize = newSize;
-    return true;
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::pushBack(const T& value) 
-{
-    if (!resize(mySize + 1)) { return false; }
-    myData[mySize - 1] = value;
-    return true;
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::popBack() 
-{
-    if (mySize <= 1) 
-    {
-        clear();
-        return true;
-    } 
-    else 
-    {
-        return resize(mySize - 1);
-    }
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::copy(const Vector<T>& source) 
-{
-    if (!resize(source.mySize)) { return false; }
-    assign(source);
-    return true;
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::assign(const Vector<T>& source, const size_t offset) 
-{
-    for (size_t i{}; offset + i < mySize && i < source.mySize; ++i) 
-    {
-        myData[offset + i] = source.myData[i];
-    }
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-template <size_t NumValues>
-void Vector<T>::assign(const T (&values)[NumValues], const size_t offset) 
-{
-    for (size_t i{}; i < NumValues && offset + i < mySize; ++i) 
-    {
-        myData[offset + i] = values[i];
-    }
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::addValues(const Vector<T>& source) 
-{
-    const auto offset{mySize};
-    if (!resize(mySize + source.mySize)) { return false; }
-    assign(source, offset);
-    return true;
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-template <size_t NumValues>
-bool Vector<T>::addValues(const T (&values)[NumValues]) 
-{
-    const auto offset{mySize};
-    if (!resize(mySize + NumValues)) { return false; }
-    assign(values, offset);
-    return true;
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Iterator::Iterator() = default;
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Iterator::Iterator(T& data) : myData{&data} {}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Iterator::Iterator(T* data) : myData{data} {}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::Iterator::operator++() { myData++; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::Iterator::operator--() { myData--; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::Iterator::operator++(int) { myData++; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::Iterator::operator--(int) { myData--; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::Iterator::operator+=(const size_t numIncrements)
-{
-    for (size_t i{}; i < numIncrements; ++i) { myData++; }
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::Iterator::operator-=(const size_t numIncrements)
-{
-    for (size_t i{}; i < numIncrements; ++i) { myData--; }
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::Iterator::operator==(const Iterator& other) const
-{ 
-    return myData == other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::Iterator::operator!=(const Iterator& other) const
-{ 
-    return myData != other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::Iterator::operator>(const Iterator& other) const
-{ 
-    return myData > other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::Iterator::operator<(const Iterator& other) const
-{ 
-    return myData < other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::Iterator::operator>=(const Iterator& other) const
-{ 
-    return myData >= other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::Iterator::operator<=(const Iterator& other) const
-{ 
-    return myData >= other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-T& Vector<T>::Iterator::operator*() { return *myData; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-const T& Vector<T>::Iterator::operator*() const { return *myData; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-T* Vector<T>::Iterator::operator=(Iterator& iterator) { return myData; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-const T* Vector<T>::Iterator::operator=(Iterator& iterator) const { return myData; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::ConstIterator::ConstIterator() = default;
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::ConstIterator::ConstIterator(const T& data) : myData{&data} {}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::ConstIterator::ConstIterator(const T* data) : myData{data} {}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::ConstIterator::operator++() { myData++; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::ConstIterator::operator--() { myData--; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::ConstIterator::operator++(int) { myData++; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::ConstIterator::operator--(int) { myData--; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::ConstIterator::operator+=(const size_t numIncrements)
-{
-    for (size_t i{}; i < numIncrements; ++i) { myData++; }
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::ConstIterator::operator-=(const size_t numIncrements)
-{
-    for (size_t i{}; i < numIncrements; ++i) { myData--; }
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::ConstIterator::operator==(const ConstIterator& other) const
-{ 
-    return myData == other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::ConstIterator::operator!=(const ConstIterator& other) const
-{ 
-    return myData != other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::ConstIterator::operator>(const ConstIterator& other) const
-{ 
-    return myData > other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::ConstIterator::operator<(const ConstIterator& other) const
-{ 
-    return myData < other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::ConstIterator::operator>=(const ConstIterator& other) const
-{ 
-    return myData >= other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::ConstIterator::operator<=(const ConstIterator& other) const
-{ 
-    return myData >= other.myData; 
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-const T& Vector<T>::ConstIterator::operator*() const { return *myData; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-const T* Vector<T>::ConstIterator::operator=(ConstIterator& iterator) const 
-{ 
-    return myData; 
-}
-
+/********************************************************************************
+ * @brief Implementation details for the container::Vector class.
+ * 
+ * @note Don't include this file directly.
+ ********************************************************************************/
+#pragma once 
+
+#include "utils.h"
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+typename Vector<T, Allocation>::Allocator Vector<T, Allocation>::myAllocator{};
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::Vector() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::Vector(const size_t size) { resize(size); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+template <typename... Values>
+Vector<T, Allocation>::Vector(const Values&&... values) 
+{
+    const T array[sizeof...(values)]{(values)...};
+    addValues(array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::Vector(const Vector<T, Allocation>& source) { copy(source); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::Vector(Vector&& source) 
+{
+    myData = source.myData;
+    mySize = source.mySize;
+    myCapacity = source.myCapacity;
+    source.myData = nullptr;
+    source.mySize = 0;
+    source.myCapacity = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::~Vector() { clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+T& Vector<T, Allocation>::operator[](const size_t index) { return myData[index]; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+const T& Vector<T, Allocation>::operator[](const size_t index) const { return myData[index]; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+template <typename... Values>
+void Vector<T, Allocation>::operator=(const Values&&... values) 
+{
+    clear();
+    copy(values...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::operator=(const Vector<T, Allocation>& source) 
+{
+    clear();
+    copy(source);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::operator=(Vector<T, Allocation>&& source) 
+{
+    if (&source == this) { return; }
+    clear();
+    myData = source.myData;
+    mySize = source.mySize;
+    myCapacity = source.myCapacity;
+    source.myData = nullptr;
+    source.mySize = 0;
+    source.myCapacity = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+template <size_t NumValues>
+void Vector<T, Allocation>::operator+=(const T (&values)[NumValues]) { addValues(values); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::operator+=(const Vector<T, Allocation>& source) { addValues(source); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+T* Vector<T, Allocation>::data() { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+const T* Vector<T, Allocation>::data() const { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+size_t Vector<T, Allocation>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+size_t Vector<T, Allocation>::capacity() const { return myCapacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+typename Vector<T, Allocation>::Iterator Vector<T, Allocation>::begin() { return Iterator{myData}; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+typename Vector<T, Allocation>::ConstIterator Vector<T, Allocation>::begin() const 
+{ 
+    return ConstIterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+typename Vector<T, Allocation>::Iterator Vector<T, Allocation>::end() 
+{ 
+    return Iterator{myData + mySize}; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+typename Vector<T, Allocation>::ConstIterator Vector<T, Allocation>::end() const 
+{ 
+    return ConstIterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+typename Vector<T, Allocation>::Iterator Vector<T, Allocation>::rbegin() 
+{ 
+    return mySize > 0 ? Iterator{myData + mySize - 1} : Iterator{nullptr}; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+typename Vector<T, Allocation>::ConstIterator Vector<T, Allocation>::rbegin() const 
+{ 
+    return mySize > 0 ? ConstIterator{myData + mySize - 1} : ConstIterator{nullptr}; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+typename Vector<T, Allocation>::Iterator Vector<T, Allocation>::rend() 
+{ 
+    return mySize > 0 ? Iterator{myData - 1} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+typename Vector<T, Allocation>::ConstIterator Vector<T, Allocation>::rend() const 
+{ 
+    return mySize > 0 ? ConstIterator{myData - 1} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+T* Vector<T, Allocation>::last() { return mySize > 0 ? end() - 1 : nullptr; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+const T* Vector<T, Allocation>::last() const { return mySize > 0 ? end() - 1 : nullptr; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::clear() 
+{
+    myAllocator.deallocate(myData);
+    myData = nullptr;
+    mySize = 0;
+    myCapacity = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::resize(const size_t newSize) 
+{
+    if (newSize > myCapacity && 
+        realloc(nextCapacity(myCapacity, newSize)) == nullptr) 
+    { 
+        return false; 
+    }
+    mySize = newSize;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::reserve(const size_t newCapacity) 
+{
+    if (newCapacity <= myCapacity) { return true; }
+    return realloc(newCapacity) != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::shrinkToFit() 
+{
+    if (mySize == myCapacity) { return true; }
+    if (mySize == 0) 
+    {
+        clear();
+        return true;
+    }
+    return realloc(mySize) != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::pushBack(const T& value) 
+{
+    if (!resize(mySize + 1)) { return false; }
+    myData[mySize - 1] = value;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::pushBack(T&& value) 
+{
+    if (!resize(mySize + 1)) { return false; }
+    myData[mySize - 1] = utils::move(value);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+template <typename... Args>
+bool Vector<T, Allocation>::emplaceBack(Args&&... args) 
+{
+    if (!resize(mySize + 1)) { return false; }
+    utils::construct(myData + mySize - 1, utils::forward<Args>(args)...);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::popBack() 
+{
+    if (mySize > 0) { mySize--; }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::copy(const Vector<T, Allocation>& source) 
+{
+    if (!resize(source.mySize)) { return false; }
+    assign(source);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::assign(const Vector<T, Allocation>& source, const size_t offset) 
+{
+    if (offset >= mySize) { return; }
+    const auto count{source.mySize < mySize - offset ? source.mySize : mySize - offset};
+    utils::copyElements(myData + offset, source.myData, count);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+template <size_t NumValues>
+void Vector<T, Allocation>::assign(const T (&values)[NumValues], const size_t offset) 
+{
+    if (offset >= mySize) { return; }
+    const auto count{NumValues < mySize - offset ? NumValues : mySize - offset};
+    utils::copyElements(myData + offset, values, count);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::addValues(const Vector<T, Allocation>& source) 
+{
+    const auto offset{mySize};
+    if (!resize(mySize + source.mySize)) { return false; }
+    assign(source, offset);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+template <size_t NumValues>
+bool Vector<T, Allocation>::addValues(const T (&values)[NumValues]) 
+{
+    const auto offset{mySize};
+    if (!resize(mySize + NumValues)) { return false; }
+    assign(values, offset);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+T* Vector<T, Allocation>::realloc(const size_t newCapacity) 
+{
+    auto copy{myAllocator.reallocate(myData, myCapacity, newCapacity)};
+    if (copy == nullptr) { return nullptr; }
+    myData = copy;
+    myCapacity = newCapacity;
+    return myData;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+constexpr size_t Vector<T, Allocation>::nextCapacity(const size_t currentCapacity, 
+                                         const size_t requestedSize) 
+{
+    const size_t grownCapacity{currentCapacity > 0 ? 2 * currentCapacity : MinCapacity};
+    return grownCapacity > requestedSize ? grownCapacity : requestedSize;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::Iterator::Iterator() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::Iterator::Iterator(T& data) : myData{&data} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::Iterator::Iterator(T* data) : myData{data} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::Iterator::operator++() { myData++; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::Iterator::operator--() { myData--; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::Iterator::operator++(int) { myData++; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::Iterator::operator--(int) { myData--; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::Iterator::operator+=(const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i) { myData++; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::Iterator::operator-=(const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i) { myData--; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::Iterator::operator==(const Iterator& other) const
+{ 
+    return myData == other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::Iterator::operator!=(const Iterator& other) const
+{ 
+    return myData != other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::Iterator::operator>(const Iterator& other) const
+{ 
+    return myData > other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::Iterator::operator<(const Iterator& other) const
+{ 
+    return myData < other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::Iterator::operator>=(const Iterator& other) const
+{ 
+    return myData >= other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::Iterator::operator<=(const Iterator& other) const
+{ 
+    return myData <= other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+T& Vector<T, Allocation>::Iterator::operator*() { return *myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+const T& Vector<T, Allocation>::Iterator::operator*() const { return *myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::ConstIterator::ConstIterator() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::ConstIterator::ConstIterator(const T& data) : myData{&data} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+Vector<T, Allocation>::ConstIterator::ConstIterator(const T* data) : myData{data} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::ConstIterator::operator++() { myData++; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::ConstIterator::operator--() { myData--; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::ConstIterator::operator++(int) { myData++; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::ConstIterator::operator--(int) { myData--; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::ConstIterator::operator+=(const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i) { myData++; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+void Vector<T, Allocation>::ConstIterator::operator-=(const size_t numIncrements)
+{
+    for (size_t i{}; i < numIncrements; ++i) { myData--; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::ConstIterator::operator==(const ConstIterator& other) const
+{ 
+    return myData == other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::ConstIterator::operator!=(const ConstIterator& other) const
+{ 
+    return myData != other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::ConstIterator::operator>(const ConstIterator& other) const
+{ 
+    return myData > other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::ConstIterator::operator<(const ConstIterator& other) const
+{ 
+    return myData < other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::ConstIterator::operator>=(const ConstIterator& other) const
+{ 
+    return myData >= other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+bool Vector<T, Allocation>::ConstIterator::operator<=(const ConstIterator& other) const
+{ 
+    return myData <= other.myData; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocation>
+const T& Vector<T, Allocation>::ConstIterator::operator*() const { return *myData; }
+
 } // namespace container
\ No newline at end of file